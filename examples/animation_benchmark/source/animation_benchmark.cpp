@@ -0,0 +1,252 @@
+#include <gvk.hpp>
+
+// Headless benchmark (no window, no Vulkan device) which evaluates many instances of a skeletal animation
+// on the CPU, once serially and once via gvk::animate_into_single_target_buffer_in_parallel with different
+// numbers of worker threads. It verifies that the parallel results are exactly the same as the serial ones.
+// Beforehand, it verifies that compressed keys (see gvk::animation::compress_keys) stay within their error bounds,
+// and that skinning with the compact bone transform formats matches skinning with 4x4 matrices (see gvk::skin_position).
+//
+// Usage: animation_benchmark <path-to-animated-model> [number-of-instances] [number-of-frames]
+
+static std::vector<double> instance_times(size_t aNumInstances, const gvk::animation_clip_data& aClip, int aFrame)
+{
+	// Let every instance play the clip at a different phase, at 60 frames per second:
+	const double duration = aClip.end_time() - aClip.start_time();
+	std::vector<double> times(aNumInstances, aClip.start_time());
+	if (duration <= 0.0) {
+		return times; // A single pose; std::fmod would return NaN
+	}
+	for (size_t i = 0; i < aNumInstances; ++i) {
+		times[i] = aClip.start_time() + std::fmod(static_cast<double>(aFrame) / 60.0 + duration * static_cast<double>(i) / static_cast<double>(aNumInstances), duration);
+	}
+	return times;
+}
+
+// Splits an affine transform (without shear) into translation, rotation, and scale:
+static std::tuple<glm::vec3, glm::quat, glm::vec3> decompose_transform(const glm::mat4& aMatrix)
+{
+	const glm::vec3 scale{ glm::length(glm::vec3{ aMatrix[0] }), glm::length(glm::vec3{ aMatrix[1] }), glm::length(glm::vec3{ aMatrix[2] }) };
+	const glm::quat rotation = glm::quat_cast(glm::mat3{ glm::vec3{ aMatrix[0] } / scale.x, glm::vec3{ aMatrix[1] } / scale.y, glm::vec3{ aMatrix[2] } / scale.z });
+	return std::make_tuple(glm::vec3{ aMatrix[3] }, rotation, scale);
+}
+
+// Compresses the keys of a copy of aPrototype, samples the local bone transforms of both at all key times,
+// and checks that the maximum errors stay within the bounds of the compression settings:
+static bool verify_key_compression(const gvk::animation& aPrototype, const gvk::animation_clip_data& aClip)
+{
+	gvk::animation_compression_settings settings;
+	settings.mRotationQuantization = gvk::rotation_quantization::smallest_three_48bit;
+	settings.mMaxRotationError = 2.0f * gvk::max_rotation_quantization_error(settings.mRotationQuantization);
+
+	auto compressed = aPrototype;
+	const auto stats = compressed.compress_keys(settings);
+	bool withinBounds = stats.mMaxPositionError <= settings.mMaxPositionError && stats.mMaxRotationError <= settings.mMaxRotationError && stats.mMaxScalingError <= settings.mMaxScalingError;
+
+	// Allow for the rounding errors of composing and decomposing the transforms:
+	constexpr float tolerance = 1e-5f;
+	auto original = aPrototype;
+	std::vector<glm::mat4> originalLocals(aPrototype.number_of_bone_matrices());
+	std::vector<glm::mat4> compressedLocals(aPrototype.number_of_bone_matrices());
+	float maxPositionError = 0.0f, maxRotationError = 0.0f, maxScalingError = 0.0f;
+	for (double ticks : aPrototype.animation_key_times_within_clip(aClip)) {
+		const double time = ticks / aClip.mTicksPerSecond;
+		original.animate(aClip, time, [&originalLocals](gvk::mesh_bone_info aInfo, const glm::mat4&, const glm::mat4&, const glm::mat4&, const glm::mat4& aLocalTransform) {
+			originalLocals[aInfo.mGlobalBoneIndexOffset + aInfo.mMeshLocalBoneIndex] = aLocalTransform;
+		});
+		compressed.animate(aClip, time, [&compressedLocals](gvk::mesh_bone_info aInfo, const glm::mat4&, const glm::mat4&, const glm::mat4&, const glm::mat4& aLocalTransform) {
+			compressedLocals[aInfo.mGlobalBoneIndexOffset + aInfo.mMeshLocalBoneIndex] = aLocalTransform;
+		});
+		for (size_t i = 0; i < originalLocals.size(); ++i) {
+			const auto [t0, r0, s0] = decompose_transform(originalLocals[i]);
+			const auto [t1, r1, s1] = decompose_transform(compressedLocals[i]);
+			const glm::quat difference = glm::conjugate(r0) * r1;
+			const float positionError = glm::distance(t0, t1);
+			const float rotationError = 2.0f * std::atan2(glm::length(glm::vec3{ difference.x, difference.y, difference.z }), std::abs(difference.w));
+			const float scalingError = glm::distance(s0, s1);
+			maxPositionError = std::max(maxPositionError, positionError);
+			maxRotationError = std::max(maxRotationError, rotationError);
+			maxScalingError = std::max(maxScalingError, scalingError);
+			withinBounds = withinBounds
+				&& positionError <= settings.mMaxPositionError + tolerance * std::max(1.0f, glm::length(t0))
+				&& rotationError <= settings.mMaxRotationError + tolerance
+				&& scalingError <= settings.mMaxScalingError + tolerance * std::max(1.0f, glm::length(s0));
+		}
+	}
+
+	LOG_INFO__(fmt::format("Key compression: {} -> {} keys, ratio {:.2f}x; reported max. errors: {:.3g} / {:.3g} rad / {:.3g}, sampled max. errors: {:.3g} / {:.3g} rad / {:.3g}, {}",
+		stats.mKeysBefore, stats.mKeysAfter, stats.compression_ratio(), stats.mMaxPositionError, stats.mMaxRotationError, stats.mMaxScalingError,
+		maxPositionError, maxRotationError, maxScalingError, withinBounds ? "within bounds" : "OUT OF BOUNDS"));
+	return withinBounds;
+}
+
+// Skins all vertices with the bone transforms written in each of the bone transform formats, and compares the
+// results to those of 4x4 matrices. Dual quaternions blend differently and can not represent scaling, therefore
+// they are only compared for vertices which are influenced by one single, rigid bone:
+static bool verify_skinning_formats(const gvk::animation& aPrototype, const gvk::animation_clip_data& aClip, const std::vector<glm::vec3>& aPositions, const std::vector<glm::vec4>& aBoneWeights, const std::vector<glm::uvec4>& aBoneIndices)
+{
+	const size_t numBones = aPrototype.number_of_bone_matrices();
+	if (0 == numBones) {
+		return true;
+	}
+
+	auto instance = aPrototype;
+	const double time = 0.5 * (aClip.start_time() + aClip.end_time());
+	std::vector<glm::vec4> matrices(numBones * gvk::vec4s_per_bone_transform(gvk::bone_transform_format::matrix_4x4));
+	std::vector<glm::vec4> affineRows(numBones * gvk::vec4s_per_bone_transform(gvk::bone_transform_format::affine_3x4));
+	std::vector<glm::vec4> dualQuaternions(numBones * gvk::vec4s_per_bone_transform(gvk::bone_transform_format::dual_quaternion));
+	instance.animate_into_single_target_buffer(aClip, time, gvk::bone_matrices_space::mesh_space, gvk::bone_transform_format::matrix_4x4, matrices.data());
+	instance.animate_into_single_target_buffer(aClip, time, gvk::bone_matrices_space::mesh_space, gvk::bone_transform_format::affine_3x4, affineRows.data());
+	instance.animate_into_single_target_buffer(aClip, time, gvk::bone_matrices_space::mesh_space, gvk::bone_transform_format::dual_quaternion, dualQuaternions.data());
+
+	auto isRigid = [&matrices](uint32_t aBoneIndex) {
+		const glm::mat4 boneMatrix = gvk::load_bone_transform(matrices.data() + 4 * static_cast<size_t>(aBoneIndex), gvk::bone_transform_format::matrix_4x4);
+		const glm::mat3 linear{ boneMatrix };
+		return glm::abs(glm::length(linear[0]) - 1.0f) < 1e-3f && glm::abs(glm::length(linear[1]) - 1.0f) < 1e-3f && glm::abs(glm::length(linear[2]) - 1.0f) < 1e-3f && glm::determinant(linear) > 0.0f;
+	};
+
+	// Vertices of meshes without bones might reference bones beyond the single target buffer:
+	auto isSkinned = [&](size_t aVertex) {
+		const glm::bvec4 inRange = glm::lessThan(aBoneIndices[aVertex], glm::uvec4{ static_cast<uint32_t>(numBones) });
+		for (int i = 0; i < 4; ++i) {
+			if (0.0f != aBoneWeights[aVertex][i] && !inRange[i]) {
+				return false;
+			}
+		}
+		return true;
+	};
+
+	std::vector<glm::vec3> reference(aPositions.size());
+	float extent = 1.0f;
+	for (size_t v = 0; v < aPositions.size(); ++v) {
+		if (!isSkinned(v)) {
+			continue;
+		}
+		reference[v] = gvk::skin_position(aPositions[v], aBoneIndices[v], aBoneWeights[v], matrices.data(), gvk::bone_transform_format::matrix_4x4);
+		extent = std::max(extent, glm::length(reference[v]));
+	}
+
+	float maxAffineError = 0.0f, maxDualQuaternionError = 0.0f;
+	size_t numRigidVertices = 0;
+	for (size_t v = 0; v < aPositions.size(); ++v) {
+		if (!isSkinned(v)) {
+			continue;
+		}
+		maxAffineError = std::max(maxAffineError, glm::distance(reference[v], gvk::skin_position(aPositions[v], aBoneIndices[v], aBoneWeights[v], affineRows.data(), gvk::bone_transform_format::affine_3x4)));
+
+		const int dominant = aBoneWeights[v][0] >= aBoneWeights[v][1] && aBoneWeights[v][0] >= aBoneWeights[v][2] && aBoneWeights[v][0] >= aBoneWeights[v][3] ? 0
+			: aBoneWeights[v][1] >= aBoneWeights[v][2] && aBoneWeights[v][1] >= aBoneWeights[v][3] ? 1
+			: aBoneWeights[v][2] >= aBoneWeights[v][3] ? 2 : 3;
+		if (aBoneWeights[v][dominant] >= 0.9999f && isRigid(aBoneIndices[v][dominant])) {
+			++numRigidVertices;
+			maxDualQuaternionError = std::max(maxDualQuaternionError, glm::distance(reference[v], gvk::skin_position(aPositions[v], aBoneIndices[v], aBoneWeights[v], dualQuaternions.data(), gvk::bone_transform_format::dual_quaternion)));
+		}
+	}
+
+	// Without any weights, dual quaternion skinning must leave the position untransformed:
+	const glm::vec3 unweighted{ 1.0f, 2.0f, 3.0f };
+	const bool unweightedUnchanged = unweighted == gvk::skin_position(unweighted, glm::uvec4{ 0u }, glm::vec4{ 0.0f }, dualQuaternions.data(), gvk::bone_transform_format::dual_quaternion);
+
+	const bool withinBounds = maxAffineError <= 1e-5f * extent && maxDualQuaternionError <= 1e-4f * extent && unweightedUnchanged;
+	LOG_INFO__(fmt::format("Skinning {} vertices: max. error of affine 3x4 rows {:.3g}, of dual quaternions {:.3g} ({} vertices with one rigid bone), relative to an extent of {:.3g}, {}",
+		aPositions.size(), maxAffineError, maxDualQuaternionError, numRigidVertices, extent, withinBounds ? "within bounds" : "OUT OF BOUNDS"));
+	return withinBounds;
+}
+
+int main(int argc, char** argv) // <== Starting point ==
+{
+	try {
+		if (argc < 2) {
+			LOG_ERROR("Usage: animation_benchmark <path-to-animated-model> [number-of-instances] [number-of-frames]");
+			return 1;
+		}
+		const size_t numInstances = argc > 2 ? std::stoul(argv[2]) : 1000;
+		const int numFrames = argc > 3 ? std::stoi(argv[3]) : 100;
+
+		auto model = gvk::model_t::load_from_file(argv[1], aiProcess_Triangulate);
+		if (!model->handle()->HasAnimations()) {
+			LOG_ERROR(fmt::format("The model '{}' does not contain any animations.", argv[1]));
+			return 1;
+		}
+		auto clip = model->load_animation_clip(0, 0.0, std::numeric_limits<double>::max());
+		if (0.0 == clip.mTicksPerSecond) {
+			clip.mTicksPerSecond = 25.0; // Assimp's default if the file does not specify it
+		}
+		const auto meshIndices = model->select_all_meshes();
+
+		// Two sets of identical instances: one for the serial reference, one for the parallel evaluation.
+		// (Instances store their current pose, therefore they can not be shared between the two.)
+		const auto prototype = model->prepare_animation(clip.mAnimationIndex, meshIndices);
+		if (!verify_key_compression(prototype, clip)) {
+			return 1;
+		}
+		std::vector<glm::vec3> positions;
+		for (auto meshIndex : meshIndices) {
+			auto meshPositions = model->positions_for_mesh(meshIndex);
+			positions.insert(std::end(positions), std::begin(meshPositions), std::end(meshPositions));
+		}
+		const auto [boneWeights, boneIndices] = model->bone_weights_and_indices_for_meshes_for_single_target_buffer(meshIndices, true);
+		if (!verify_skinning_formats(prototype, clip, positions, boneWeights, boneIndices)) {
+			return 1;
+		}
+		std::vector<gvk::animation> serialInstances(numInstances, prototype);
+		std::vector<gvk::animation> parallelInstances(numInstances, prototype);
+		const size_t numBoneMatricesPerInstance = prototype.number_of_bone_matrices();
+		std::vector<glm::mat4> serialResult(numInstances * numBoneMatricesPerInstance);
+		std::vector<glm::mat4> parallelResult(numInstances * numBoneMatricesPerInstance);
+
+		LOG_INFO__(fmt::format("Evaluating {} instances with {} animated nodes and {} bone matrices each, over {} frames",
+			numInstances, prototype.number_of_animated_nodes(), numBoneMatricesPerInstance, numFrames));
+
+		// For each number of threads, evaluate every frame serially (as reference) and in parallel:
+		const uint32_t maxThreads = std::max(1u, std::thread::hardware_concurrency());
+
+		// gvk::parallel_for runs on persistent worker threads; start them before measuring, s.t. no thread start-up is timed:
+		{
+			std::vector<gvk::animation> warmUpInstances(maxThreads, prototype);
+			std::vector<glm::mat4> warmUpResult(maxThreads * numBoneMatricesPerInstance);
+			std::vector<gvk::animation_batch_entry> entries;
+			for (auto& instance : warmUpInstances) {
+				entries.push_back(gvk::animation_batch_entry{ &instance, clip, clip.start_time() });
+			}
+			gvk::animate_into_single_target_buffer_in_parallel(entries, gvk::bone_matrices_space::mesh_space, warmUpResult.data(), maxThreads);
+		}
+
+		for (uint32_t numThreads = 1; ; numThreads = std::min(numThreads * 2, maxThreads)) {
+			double serialMs = 0.0;
+			double parallelMs = 0.0;
+			bool identical = true;
+			for (int frame = 0; frame < numFrames; ++frame) {
+				const auto times = instance_times(numInstances, clip, frame);
+
+				auto start = std::chrono::steady_clock::now();
+				for (size_t i = 0; i < numInstances; ++i) {
+					serialInstances[i].animate_into_single_target_buffer(clip, times[i], gvk::bone_matrices_space::mesh_space, serialResult.data() + i * numBoneMatricesPerInstance);
+				}
+				serialMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+				std::vector<gvk::animation_batch_entry> entries;
+				entries.reserve(numInstances);
+				for (size_t i = 0; i < numInstances; ++i) {
+					entries.push_back(gvk::animation_batch_entry{ &parallelInstances[i], clip, times[i] });
+				}
+				start = std::chrono::steady_clock::now();
+				gvk::animate_into_single_target_buffer_in_parallel(entries, gvk::bone_matrices_space::mesh_space, parallelResult.data(), numThreads);
+				parallelMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+				identical = identical && 0 == std::memcmp(serialResult.data(), parallelResult.data(), parallelResult.size() * sizeof(glm::mat4));
+			}
+			LOG_INFO__(fmt::format("{:2} threads: {:8.3f} ms per frame (serial: {:8.3f} ms), speedup {:5.2f}x, results {}",
+				numThreads, parallelMs / numFrames, serialMs / numFrames, serialMs / parallelMs, identical ? "identical" : "DIFFERENT"));
+			if (!identical) {
+				return 1;
+			}
+			if (numThreads == maxThreads) {
+				break;
+			}
+		}
+	}
+	catch (gvk::logic_error&) { return 1; }
+	catch (gvk::runtime_error&) { return 1; }
+	catch (avk::logic_error&) { return 1; }
+	catch (avk::runtime_error&) { return 1; }
+}
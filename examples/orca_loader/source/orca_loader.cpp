@@ -68,6 +68,8 @@ public: // v== avk::invokee overrides which will be invoked by the framework ==v
 		// Later, we'll use ONE draw call PER MATERIAL to draw the whole scene.
 		std::vector<gvk::material_config> allMatConfigs;
 		mDrawCalls.clear();
+		// Record all the buffer uploads into one command buffer and submit them at once after the loop:
+		gvk::upload_batch uploads(avk::sync::wait_idle());
 		for (const auto& pair : distinctMaterialsOrca) {
 			allMatConfigs.push_back(pair.first);
 			const int matIndex = static_cast<int>(allMatConfigs.size()) - 1;
@@ -81,7 +83,7 @@ public: // v== avk::invokee overrides which will be invoked by the framework ==v
 				// Get a buffer containing all positions, and one containing all indices for all submeshes with this material
 				auto [positionsBuffer, indicesBuffer] = gvk::create_vertex_and_index_buffers(
 					{ gvk::make_models_and_meshes_selection(modelData.mLoadedModel, indices.mMeshIndices) }, {},
-					avk::sync::wait_idle()
+					uploads.sync()
 				);
 				positionsBuffer.enable_shared_ownership(); // Enable multiple owners of this buffer, because there might be multiple model-instances and hence, multiple draw calls that want to use this buffer.
 				indicesBuffer.enable_shared_ownership(); // Enable multiple owners of this buffer, because there might be multiple model-instances and hence, multiple draw calls that want to use this buffer.
@@ -89,14 +91,14 @@ public: // v== avk::invokee overrides which will be invoked by the framework ==v
 				// Get a buffer containing all texture coordinates for all submeshes with this material
 				auto texCoordsBuffer = gvk::create_2d_texture_coordinates_flipped_buffer(
 					{ gvk::make_models_and_meshes_selection(modelData.mLoadedModel, indices.mMeshIndices) }, 0,
-					avk::sync::wait_idle()
+					uploads.sync()
 				);
 				texCoordsBuffer.enable_shared_ownership(); // Enable multiple owners of this buffer, because there might be multiple model-instances and hence, multiple draw calls that want to use this buffer.
 
 				// Get a buffer containing all normals for all submeshes with this material
 				auto normalsBuffer = gvk::create_normals_buffer(
 					{ gvk::make_models_and_meshes_selection(modelData.mLoadedModel, indices.mMeshIndices) }, 
-					avk::sync::wait_idle()
+					uploads.sync()
 				);
 				normalsBuffer.enable_shared_ownership(); // Enable multiple owners of this buffer, because there might be multiple model-instances and hence, multiple draw calls that want to use this buffer.
 
@@ -111,6 +113,7 @@ public: // v== avk::invokee overrides which will be invoked by the framework ==v
 				}
 			}
 		}
+		uploads.submit();
 
 		endPart = gvk::context().get_time();
 		times.emplace_back(std::make_tuple("create materials config", endPart - startPart));
@@ -199,10 +202,11 @@ public: // v== avk::invokee overrides which will be invoked by the framework ==v
 		std::unordered_map<gvk::material_config, std::vector<gvk::model_and_mesh_indices>> distinctMaterialsOrca;
 
 		const std::string cacheFilePath(aPathToOrcaScene + ".cache");
-		// If a cache file exists, i.e. the scene was serialized during a previous load, initialize the serializer in deserialize mode,
-		// else initialize the serializer in serialize mode to create the cache file while processing the scene.
-		auto serializer = gvk::serializer(cacheFilePath, gvk::does_cache_file_exist(cacheFilePath) ?
-			gvk::serializer::mode::deserialize : gvk::serializer::mode::serialize);
+		const auto assimpFlags = aiProcess_Triangulate | aiProcess_PreTransformVertices | gvk::model_t::sOptimizeVertexOrder;
+		// If an up-to-date cache file exists, i.e. the scene was serialized during a previous load with the same Assimp flags, and
+		// none of the files it was created from have changed since, initialize the serializer in deserialize mode, else initialize
+		// the serializer in serialize mode to (re-)create the cache file while processing the scene.
+		auto serializer = gvk::serializer(cacheFilePath, assimpFlags);
 
 		float start = gvk::context().get_time();
 		float startPart = start;
@@ -212,7 +216,13 @@ public: // v== avk::invokee overrides which will be invoked by the framework ==v
 		// Load orca scene for usage and serialization, loading the scene is not required if a cache file exists, i.e. mode == deserialize
 		if (serializer.mode() == gvk::serializer::mode::serialize) {
 			// Load an ORCA scene from file:
-			orca = gvk::orca_scene_t::load_from_file(aPathToOrcaScene);
+			orca = gvk::orca_scene_t::load_from_file(aPathToOrcaScene, assimpFlags);
+			// Record all the files the cache is created from, s.t. it gets rebuilt if any of them changes.
+			// (Images are recorded by convert_for_gpu_usage_cached.)
+			serializer.add_source_file(aPathToOrcaScene);
+			for (const auto& modelData : orca->models()) {
+				serializer.add_source_file(modelData.mFullPathName);
+			}
 			// Get all the different materials from the whole scene:
 			distinctMaterialsOrca = orca->distinct_material_configs_for_all_models();
 
@@ -229,6 +239,8 @@ public: // v== avk::invokee overrides which will be invoked by the framework ==v
 		// Later, we'll use ONE draw call PER MATERIAL to draw the whole scene.
 		std::vector<gvk::material_config> allMatConfigs;
 		mDrawCalls.clear();
+		// Record all the buffer uploads into one command buffer and submit them at once after the loop:
+		gvk::upload_batch uploads(avk::sync::wait_idle());
 		auto materials = distinctMaterialsOrca.begin();
 		for (int materialIndex = 0; materialIndex < numDistinctMaterials; ++materialIndex) {
 			// meshIndices is only needed during serialization, otherwise the serializer handles everything
@@ -258,20 +270,20 @@ public: // v== avk::invokee overrides which will be invoked by the framework ==v
 
 				// Get a buffer containing all positions, and one containing all indices for all submeshes with this material
 				auto [positionsBuffer, indicesBuffer] = gvk::create_vertex_and_index_buffers_cached(
-					serializer, modelAndMeshes, {}, avk::sync::wait_idle()
+					serializer, modelAndMeshes, {}, uploads.sync()
 				);
 				positionsBuffer.enable_shared_ownership(); // Enable multiple owners of this buffer, because there might be multiple model-instances and hence, multiple draw calls that want to use this buffer.
 				indicesBuffer.enable_shared_ownership(); // Enable multiple owners of this buffer, because there might be multiple model-instances and hence, multiple draw calls that want to use this buffer.
 
 				// Get a buffer containing all texture coordinates for all submeshes with this material
 				auto texCoordsBuffer = gvk::create_2d_texture_coordinates_flipped_buffer_cached(
-					serializer, modelAndMeshes, 0, avk::sync::wait_idle()
+					serializer, modelAndMeshes, 0, uploads.sync()
 				);
 				texCoordsBuffer.enable_shared_ownership(); // Enable multiple owners of this buffer, because there might be multiple model-instances and hence, multiple draw calls that want to use this buffer.
 
 				// Get a buffer containing all normals for all submeshes with this material
 				auto normalsBuffer = gvk::create_normals_buffer_cached(
-					serializer, modelAndMeshes, avk::sync::wait_idle()
+					serializer, modelAndMeshes, uploads.sync()
 				);
 				normalsBuffer.enable_shared_ownership(); // Enable multiple owners of this buffer, because there might be multiple model-instances and hence, multiple draw calls that want to use this buffer.
 
@@ -300,6 +312,7 @@ public: // v== avk::invokee overrides which will be invoked by the framework ==v
 				}
 			}
 		}
+		uploads.submit();
 		endPart = gvk::context().get_time();
 		times.emplace_back(std::make_tuple("create materials config", endPart - startPart));
 		startPart = gvk::context().get_time();
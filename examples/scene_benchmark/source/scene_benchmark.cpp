@@ -0,0 +1,367 @@
+#include <gvk.hpp>
+#include <random>
+
+// Headless benchmark (no window, no Vulkan device) of the CPU-side scene structures. It verifies the results of
+// gvk::bounding_volume_hierarchy against a linear scan over all boxes, for frustum, ray, and nearest-primitive
+// queries, before and after moving primitives. An incremental refit must give the same node bounds as a full
+// refit, and a build must not depend on the number of threads. If an ORCA scene is passed, the same is checked
+// for the hierarchy over its instances (gvk::orca_scene_bvh).
+// Then, it verifies that updating a gvk::scene_graph in parallel gives exactly the same world matrices as updating
+// it serially, before and after modifying it, and that imported transform hierarchies match gvk::transform.
+//
+// Usage: scene_benchmark [number-of-elements] [path-to-orca-scene]
+
+static double milliseconds_since(std::chrono::steady_clock::time_point aStart)
+{
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - aStart).count();
+}
+
+// The primitives whose boxes are visible in the given frustum, in ascending order:
+static std::vector<uint32_t> visible_boxes_linear(const gvk::frustum& aFrustum, std::span<const gvk::aabb> aBoxes)
+{
+	std::vector<uint32_t> result;
+	for (uint32_t i = 0; i < static_cast<uint32_t>(aBoxes.size()); ++i) {
+		if (!aBoxes[i].is_empty() && gvk::is_box_visible(aFrustum, aBoxes[i].mMin, aBoxes[i].mMax)) {
+			result.push_back(i);
+		}
+	}
+	return result;
+}
+
+// Compares all three query types of the given hierarchy against a linear scan over aBoxes, which must be the boxes
+// the hierarchy has been built or refitted with. Cameras, rays, and points are spread over aRegion.
+static bool verify_queries(const gvk::bounding_volume_hierarchy& aBvh, std::span<const gvk::aabb> aBoxes, const gvk::aabb& aRegion, std::mt19937& aRandom, const char* aDescription)
+{
+	std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+	auto randomPointInRegion = [&]() {
+		return aRegion.mMin + (aRegion.mMax - aRegion.mMin) * glm::vec3{ unit(aRandom), unit(aRandom), unit(aRandom) };
+	};
+	const float regionSize = glm::length(aRegion.mMax - aRegion.mMin);
+
+	// Frustum queries from cameras within the region, looking at other points of it:
+	constexpr int numCameras = 20;
+	const glm::mat4 projection = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.01f * regionSize, 0.5f * regionSize);
+	size_t frustumMismatches = 0, numVisible = 0;
+	double frustumMs = 0.0, linearFrustumMs = 0.0;
+	std::vector<uint32_t> visible;
+	for (int i = 0; i < numCameras; ++i) {
+		const auto frustum = gvk::frustum_from_matrix(projection * glm::lookAt(randomPointInRegion(), randomPointInRegion(), glm::vec3{ 0.0f, 1.0f, 0.0f }));
+		auto start = std::chrono::steady_clock::now();
+		aBvh.query_frustum(frustum, visible);
+		frustumMs += milliseconds_since(start);
+		start = std::chrono::steady_clock::now();
+		const auto reference = visible_boxes_linear(frustum, aBoxes);
+		linearFrustumMs += milliseconds_since(start);
+		std::sort(std::begin(visible), std::end(visible));
+		frustumMismatches += visible == reference ? 0 : 1;
+		numVisible += reference.size();
+	}
+
+	// Closest-hit ray queries; the hit primitive may differ if boxes are entered at the same distance, the distance may not:
+	constexpr int numRays = 1000;
+	size_t rayMismatches = 0, numHits = 0;
+	double rayMs = 0.0, linearRayMs = 0.0;
+	for (int i = 0; i < numRays; ++i) {
+		const glm::vec3 origin = randomPointInRegion();
+		const glm::vec3 direction = randomPointInRegion() - origin;
+		auto start = std::chrono::steady_clock::now();
+		const auto hit = aBvh.closest_hit(origin, direction);
+		rayMs += milliseconds_since(start);
+		start = std::chrono::steady_clock::now();
+		const glm::vec3 inverseDirection = 1.0f / direction;
+		std::optional<float> reference;
+		for (const auto& box : aBoxes) {
+			float entry;
+			if (!box.is_empty() && gvk::intersect_ray_box(origin, inverseDirection, box, reference.value_or(std::numeric_limits<float>::max()), entry)) {
+				reference = entry;
+			}
+		}
+		linearRayMs += milliseconds_since(start);
+		rayMismatches += hit.has_value() == reference.has_value() && (!hit.has_value() || hit->mDistance == reference.value()) ? 0 : 1;
+		numHits += reference.has_value() ? 1 : 0;
+	}
+
+	// Nearest-primitive queries; compare the distances, since several boxes can contain the point:
+	constexpr int numPoints = 200;
+	size_t nearestMismatches = 0;
+	double nearestMs = 0.0, linearNearestMs = 0.0;
+	for (int i = 0; i < numPoints; ++i) {
+		const glm::vec3 point = randomPointInRegion();
+		auto start = std::chrono::steady_clock::now();
+		const auto nearest = aBvh.nearest(point);
+		nearestMs += milliseconds_since(start);
+		start = std::chrono::steady_clock::now();
+		std::optional<float> reference;
+		for (const auto& box : aBoxes) {
+			if (!box.is_empty()) {
+				reference = std::min(reference.value_or(std::numeric_limits<float>::max()), gvk::squared_distance_to_box(point, box));
+			}
+		}
+		linearNearestMs += milliseconds_since(start);
+		nearestMismatches += nearest.has_value() == reference.has_value() && (!nearest.has_value() || nearest->mDistance == std::sqrt(reference.value())) ? 0 : 1;
+	}
+
+	LOG_INFO__(fmt::format("{}: frustum {:7.3f} ms (linear {:7.3f} ms), ray {:7.4f} ms (linear {:7.4f} ms), nearest {:7.4f} ms (linear {:7.4f} ms) per query",
+		aDescription, frustumMs / numCameras, linearFrustumMs / numCameras, rayMs / numRays, linearRayMs / numRays, nearestMs / numPoints, linearNearestMs / numPoints));
+	LOG_INFO__(fmt::format("{}: {} visible boxes per camera, {} of {} rays hit; mismatches: frustum {}, ray {}, nearest {}",
+		aDescription, numVisible / numCameras, numHits, numRays, frustumMismatches, rayMismatches, nearestMismatches));
+	return 0 == frustumMismatches + rayMismatches + nearestMismatches;
+}
+
+// Returns true if both hierarchies have exactly the same nodes and primitive order:
+static bool have_same_structure(const gvk::bounding_volume_hierarchy& aA, const gvk::bounding_volume_hierarchy& aB)
+{
+	return aA.nodes().size() == aB.nodes().size()
+		&& 0 == std::memcmp(aA.nodes().data(), aB.nodes().data(), aA.nodes().size_bytes())
+		&& std::equal(std::begin(aA.primitive_indices()), std::end(aA.primitive_indices()), std::begin(aB.primitive_indices()), std::end(aB.primitive_indices()));
+}
+
+// Builds hierarchies over random boxes, verifies their queries, moves some of the boxes, and verifies again:
+static bool verify_bounding_volume_hierarchy(size_t aNumBoxes)
+{
+	std::mt19937 random(42);
+	// A flat region, like a city or a landscape, with boxes of different sizes:
+	const gvk::aabb region{ glm::vec3{ -500.0f, -20.0f, -500.0f }, glm::vec3{ 500.0f, 20.0f, 500.0f } };
+	std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+	std::uniform_real_distribution<float> halfSize(0.1f, 3.0f);
+	std::vector<gvk::aabb> boxes(aNumBoxes);
+	for (auto& box : boxes) {
+		const glm::vec3 center = region.mMin + (region.mMax - region.mMin) * glm::vec3{ unit(random), unit(random), unit(random) };
+		const glm::vec3 extent{ halfSize(random), halfSize(random), halfSize(random) };
+		box = gvk::aabb{ center - extent, center + extent };
+	}
+	// Empty boxes must never be reported:
+	for (size_t i = 0; i < boxes.size(); i += 1000) {
+		boxes[i] = gvk::aabb{};
+	}
+
+	gvk::bounding_volume_hierarchy bvh;
+	auto start = std::chrono::steady_clock::now();
+	bvh.build(boxes);
+	const double parallelBuildMs = milliseconds_since(start);
+	gvk::bounding_volume_hierarchy serialBvh;
+	start = std::chrono::steady_clock::now();
+	serialBvh.build(boxes, 1);
+	const double serialBuildMs = milliseconds_since(start);
+	const bool sameStructure = have_same_structure(bvh, serialBvh);
+	LOG_INFO__(fmt::format("Built a hierarchy over {} boxes with {} nodes and an SAH cost of {:.2f} in {:.2f} ms (serially: {:.2f} ms), structure {}",
+		aNumBoxes, bvh.nodes().size(), bvh.sah_cost(), parallelBuildMs, serialBuildMs, sameStructure ? "identical" : "DIFFERENT"));
+	if (!sameStructure || !verify_queries(bvh, boxes, region, random, "Built")) {
+		return false;
+	}
+
+	// Move every tenth box, and empty some others; refit one hierarchy incrementally and the other one fully:
+	std::uniform_real_distribution<float> offset(-5.0f, 5.0f);
+	for (size_t i = 5; i < boxes.size(); i += 10) {
+		if (0 == i % 995) {
+			boxes[i] = gvk::aabb{};
+		}
+		else if (!boxes[i].is_empty()) {
+			const glm::vec3 movement{ offset(random), 0.0f, offset(random) };
+			boxes[i] = gvk::aabb{ boxes[i].mMin + movement, boxes[i].mMax + movement };
+		}
+		bvh.set_primitive_bounds(static_cast<uint32_t>(i), boxes[i]);
+	}
+	start = std::chrono::steady_clock::now();
+	bvh.refit();
+	const double incrementalRefitMs = milliseconds_since(start);
+	start = std::chrono::steady_clock::now();
+	serialBvh.refit(boxes);
+	const double fullRefitMs = milliseconds_since(start);
+	const bool sameRefit = have_same_structure(bvh, serialBvh);
+	LOG_INFO__(fmt::format("Refitted after moving {} boxes: incrementally in {:.3f} ms, fully in {:.3f} ms, SAH cost {:.2f}, node bounds {}",
+		aNumBoxes / 10, incrementalRefitMs, fullRefitMs, bvh.sah_cost(), sameRefit ? "identical" : "DIFFERENT"));
+	return sameRefit && verify_queries(bvh, boxes, region, random, "Refitted");
+}
+
+// Verifies the hierarchy over the instances of the given ORCA scene, before and after moving some of the instances:
+static bool verify_orca_scene_bvh(gvk::orca_scene_t& aScene)
+{
+	auto gatherInstanceBounds = [&aScene](const gvk::orca_scene_bvh& aBvh) {
+		std::vector<gvk::aabb> boxes(aBvh.bvh().number_of_primitives());
+		for (size_t m = 0; m < aScene.models().size(); ++m) {
+			const auto instanceBounds = aScene.bounds_of_instances(m);
+			for (size_t i = 0; i < instanceBounds.size(); ++i) {
+				boxes[aBvh.primitive(m, i)] = instanceBounds[i].mBox;
+			}
+		}
+		return boxes;
+	};
+
+	std::mt19937 random(7);
+	gvk::orca_scene_bvh bvh(aScene);
+	auto boxes = gatherInstanceBounds(bvh);
+	LOG_INFO__(fmt::format("Built a hierarchy over the {} instances of the ORCA scene", boxes.size()));
+	if (!verify_queries(bvh.bvh(), boxes, bvh.bvh().bounds(), random, "ORCA scene")) {
+		return false;
+	}
+
+	// Move every other instance of every model by a fraction of the scene's size:
+	const glm::vec3 movement = (bvh.bvh().bounds().mMax - bvh.bvh().bounds().mMin) * 0.05f;
+	for (size_t m = 0; m < aScene.models().size(); ++m) {
+		auto& instances = aScene.model_at_index(m).mInstances;
+		for (size_t i = 0; i < instances.size(); i += 2) {
+			instances[i].mTranslation += movement;
+			bvh.update_instance(aScene, m, i);
+		}
+	}
+	bvh.refit();
+	boxes = gatherInstanceBounds(bvh);
+	return verify_queries(bvh.bvh(), boxes, bvh.bvh().bounds(), random, "ORCA scene, moved");
+}
+
+// Largest difference between the elements of two matrices, relative to the largest element of the reference:
+static float relative_difference(const glm::mat4& aMatrix, const glm::mat4& aReference)
+{
+	float difference = 0.0f, magnitude = 1.0f;
+	for (int c = 0; c < 4; ++c) {
+		for (int r = 0; r < 4; ++r) {
+			difference = std::max(difference, std::abs(aMatrix[c][r] - aReference[c][r]));
+			magnitude = std::max(magnitude, std::abs(aReference[c][r]));
+		}
+	}
+	return difference / magnitude;
+}
+
+// Builds a scene graph whose subtrees have very different sizes: a long chain (whose nodes' subtrees are too large for
+// one parallel task), a forest of random trees, and many single nodes.
+static gvk::scene_graph create_mixed_scene_graph(size_t aNumNodes, std::mt19937& aRandom)
+{
+	std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+	auto randomTranslation = [&]() { return glm::vec3{ unit(aRandom) - 0.5f, unit(aRandom) - 0.5f, unit(aRandom) - 0.5f } * 4.0f; };
+	auto randomRotation = [&]() { return glm::angleAxis(unit(aRandom) * glm::two_pi<float>(), glm::normalize(glm::vec3{ unit(aRandom), unit(aRandom), unit(aRandom) } + 0.1f)); };
+	auto randomScale = [&]() { return glm::vec3{ 0.9f + 0.2f * unit(aRandom), 0.9f + 0.2f * unit(aRandom), 0.9f + 0.2f * unit(aRandom) }; };
+
+	gvk::scene_graph graph;
+	graph.reserve(aNumNodes);
+	const size_t chainLength = aNumNodes / 16;
+	auto parent = gvk::scene_graph::sNoParent;
+	for (size_t i = 0; i < chainLength; ++i) {
+		parent = graph.add_node(parent, randomTranslation() * 0.1f, randomRotation(), glm::vec3{ 1.0f });
+	}
+	// Every further node is a root with a probability of 10%, otherwise its parent is any of the previous non-chain nodes:
+	while (graph.size() < aNumNodes) {
+		const auto newParent = unit(aRandom) < 0.1f || chainLength == graph.size()
+			? gvk::scene_graph::sNoParent
+			: static_cast<gvk::scene_node_id_t>(std::uniform_int_distribution<size_t>(chainLength, graph.size() - 1)(aRandom));
+		graph.add_node(newParent, randomTranslation(), randomRotation(), randomScale());
+	}
+	return graph;
+}
+
+// Modifies some nodes' transforms and moves some subtrees to different parents; with the same seed, the
+// same modifications are applied:
+static void modify_scene_graph(gvk::scene_graph& aGraph, unsigned int aSeed)
+{
+	std::mt19937 random(aSeed);
+	std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+	std::uniform_int_distribution<gvk::scene_node_id_t> anyNode(0, static_cast<gvk::scene_node_id_t>(aGraph.size() - 1));
+	for (gvk::scene_node_id_t id = 0; id < static_cast<gvk::scene_node_id_t>(aGraph.size()); id += 7) {
+		aGraph.set_translation(id, aGraph.translation(id) + glm::vec3{ unit(random) - 0.5f, 0.0f, unit(random) - 0.5f });
+	}
+	for (gvk::scene_node_id_t id = 3; id < static_cast<gvk::scene_node_id_t>(aGraph.size()); id += 31) {
+		aGraph.set_rotation(id, glm::angleAxis(unit(random), glm::vec3{ 0.0f, 1.0f, 0.0f }) * aGraph.rotation(id));
+	}
+	for (int i = 0; i < 100; ++i) {
+		const auto node = anyNode(random);
+		const auto newParent = 0 == i % 10 ? gvk::scene_graph::sNoParent : anyNode(random);
+		try {
+			aGraph.set_parent(node, newParent);
+		}
+		catch (gvk::logic_error&) {
+			// newParent is part of node's subtree => skip it
+		}
+	}
+}
+
+// Updates two identical graphs, one with a single thread and one with all threads (but at least two, s.t. the nodes are
+// split into serial nodes and parallel ranges even on a single core), and checks that their world matrices are identical,
+// and that they match the world matrices computed from the nodes' parent chains:
+static bool verify_scene_graph_update(gvk::scene_graph& aSerialGraph, gvk::scene_graph& aParallelGraph, const char* aDescription)
+{
+	float maxDifference = 0.0f;
+	std::vector<glm::mat4> reference(aSerialGraph.size());
+	for (gvk::scene_node_id_t id = 0; id < static_cast<gvk::scene_node_id_t>(reference.size()); ++id) {
+		reference[id] = aSerialGraph.current_world_matrix(id);
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	aSerialGraph.update_world_matrices(1);
+	const double serialMs = milliseconds_since(start);
+	start = std::chrono::steady_clock::now();
+	const uint32_t numThreads = std::max(2u, gvk::max_worker_threads());
+	aParallelGraph.update_world_matrices(numThreads);
+	const double parallelMs = milliseconds_since(start);
+
+	const bool identical = aSerialGraph.world_matrices().size() == aParallelGraph.world_matrices().size()
+		&& 0 == std::memcmp(aSerialGraph.world_matrices().data(), aParallelGraph.world_matrices().data(), aSerialGraph.world_matrices().size_bytes());
+	for (gvk::scene_node_id_t id = 0; id < static_cast<gvk::scene_node_id_t>(reference.size()); ++id) {
+		maxDifference = std::max(maxDifference, relative_difference(aSerialGraph.world_matrix(id), reference[id]));
+	}
+	constexpr float tolerance = 1e-3f; // The parent chain of the long chain multiplies thousands of matrices
+	LOG_INFO__(fmt::format("{}: updated {} nodes with {} threads in {:.3f} ms (serially: {:.3f} ms), results {}, max. relative difference to the parent chains {:.3g}",
+		aDescription, aSerialGraph.size(), numThreads, parallelMs, serialMs, identical ? "identical" : "DIFFERENT", maxDifference));
+	return identical && maxDifference <= tolerance;
+}
+
+// Verifies the serial and the parallel update of a scene graph, and the import of transform hierarchies:
+static bool verify_scene_graph(size_t aNumNodes)
+{
+	std::mt19937 random(1234);
+	auto serialGraph = create_mixed_scene_graph(aNumNodes, random);
+	auto parallelGraph = serialGraph;
+	if (!verify_scene_graph_update(serialGraph, parallelGraph, "Scene graph")) {
+		return false;
+	}
+	modify_scene_graph(serialGraph, 99);
+	modify_scene_graph(parallelGraph, 99);
+	if (!verify_scene_graph_update(serialGraph, parallelGraph, "Scene graph, modified")) {
+		return false;
+	}
+
+	// A hierarchy of transforms, with four childs per node over four levels, gathered in depth-first order:
+	std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+	std::vector<gvk::transform::ptr> transforms{ std::make_shared<gvk::transform>(glm::vec3{ 1.0f, 2.0f, 3.0f }) };
+	std::function<void(gvk::transform::ptr, int)> addChilds = [&](gvk::transform::ptr aParent, int aLevel) {
+		for (int i = 0; 4 > aLevel && i < 4; ++i) {
+			auto child = std::make_shared<gvk::transform>(glm::vec3{ unit(random), unit(random), unit(random) }, glm::angleAxis(unit(random), glm::vec3{ 1.0f, 0.0f, 0.0f }), glm::vec3{ 0.5f + unit(random) });
+			gvk::attach_transform(aParent, child);
+			transforms.push_back(child);
+			addChilds(child, aLevel + 1);
+		}
+	};
+	addChilds(transforms.front(), 0);
+	const auto rootId = serialGraph.add_transform_hierarchy(*transforms.front());
+	serialGraph.update_world_matrices();
+	float maxDifference = 0.0f;
+	for (size_t i = 0; i < transforms.size(); ++i) {
+		maxDifference = std::max(maxDifference, relative_difference(serialGraph.world_matrix(rootId + static_cast<gvk::scene_node_id_t>(i)), transforms[i]->global_transformation_matrix()));
+	}
+	constexpr float tolerance = 1e-5f;
+	LOG_INFO__(fmt::format("Transform hierarchy of {} transforms: max. relative difference to transform::global_transformation_matrix {:.3g}", transforms.size(), maxDifference));
+	return maxDifference <= tolerance;
+}
+
+int main(int argc, char** argv) // <== Starting point ==
+{
+	try {
+		// The number of boxes of the bounding volume hierarchy, and of nodes of the scene graph:
+		const size_t numElements = argc > 1 ? std::stoul(argv[1]) : 50000;
+		if (!verify_bounding_volume_hierarchy(numElements)) {
+			return 1;
+		}
+		if (!verify_scene_graph(numElements)) {
+			return 1;
+		}
+		if (argc > 2) {
+			auto scene = gvk::orca_scene_t::load_from_file(argv[2]);
+			if (!verify_orca_scene_bvh(*scene)) {
+				return 1;
+			}
+		}
+	}
+	catch (gvk::logic_error&) { return 1; }
+	catch (gvk::runtime_error&) { return 1; }
+	catch (avk::logic_error&) { return 1; }
+	catch (avk::runtime_error&) { return 1; }
+}
@@ -159,6 +159,19 @@ namespace gvk
 
 	};
 
+	/**	Playback state of one animated node: The indices of the keys which have been found for the
+	 *	animation time of the most recent animate() invocation. They are used as starting points for
+	 *	finding the keys of the next invocation, which makes the key lookup O(1) for monotonic playback.
+	 *	Seeking and wrapping around fall back to a binary search. Therefore, the cursors are merely
+	 *	hints and never affect the results.
+	 */
+	struct animation_key_cursors
+	{
+		size_t mPosition = 0;
+		size_t mRotation = 0;
+		size_t mScaling = 0;
+	};
+
 	/**	Struct containing data about one specific animated node.
 	 *	Class animation will contain multiple of such in most cases.
 	 */
@@ -216,6 +229,11 @@ namespace gvk
 		 *	 mBoneMatrixTargets, though.)
 		 */
 		std::vector<bone_mesh_data> mBoneMeshTargets;
+
+		/** Key cursors of this node's channels, updated by animation::animate.
+		 *	They are per animation instance and are not serialized.
+		 */
+		animation_key_cursors mKeyCursors;
 	};
 
 	/** Represents possible spaces which the final bone matrices can be transformed into. */
@@ -228,8 +246,354 @@ namespace gvk
 		model_space,
 	};
 	
+	/**	Returns the first three rows of an affine bone matrix, i.e. a row-major 3x4 matrix, which is a compact
+	 *	representation for uploading bone matrices to the GPU. The fourth row of an affine matrix is always
+	 *	(0, 0, 0, 1). In GLSL, the bone matrix can be reconstructed as mat4(transpose(mat3x4(row0, row1, row2))).
+	 */
+	static inline std::array<glm::vec4, 3> to_affine_3x4_rows(const glm::mat4& aMatrix)
+	{
+		return {
+			glm::vec4{ aMatrix[0][0], aMatrix[1][0], aMatrix[2][0], aMatrix[3][0] },
+			glm::vec4{ aMatrix[0][1], aMatrix[1][1], aMatrix[2][1], aMatrix[3][1] },
+			glm::vec4{ aMatrix[0][2], aMatrix[1][2], aMatrix[2][2], aMatrix[3][2] }
+		};
+	}
+
+	/**	Converts an affine bone matrix into a unit dual quaternion, which represents its rotation and translation.
+	 *	Dual quaternions can not represent any scaling; it is removed from the matrix before the conversion.
+	 */
+	static inline glm::dualquat to_dual_quaternion(const glm::mat4& aMatrix)
+	{
+		const glm::mat3 rotation{ glm::normalize(glm::vec3{ aMatrix[0] }), glm::normalize(glm::vec3{ aMatrix[1] }), glm::normalize(glm::vec3{ aMatrix[2] }) };
+		return glm::dualquat{ glm::normalize(glm::quat_cast(rotation)), glm::vec3{ aMatrix[3] } };
+	}
+
+	/** Formats in which bone transforms can be written to memory, see animation::animate_into_single_target_buffer and animation::bake */
+	enum struct bone_transform_format
+	{
+		/** Four vec4 (64 bytes) per bone: the columns of the bone matrix, i.e. the same memory layout as glm::mat4. */
+		matrix_4x4,
+
+		/** Three vec4 (48 bytes) per bone: the first three rows of the bone matrix, see to_affine_3x4_rows. */
+		affine_3x4,
+
+		/** Two vec4 (32 bytes) per bone: the real part and the dual part (x, y, z, w each) of a unit dual quaternion, see to_dual_quaternion. */
+		dual_quaternion,
+	};
+
+	/** The number of vec4 elements which one bone transform occupies in the given format */
+	static inline uint32_t vec4s_per_bone_transform(bone_transform_format aFormat)
+	{
+		switch (aFormat) {
+		case bone_transform_format::matrix_4x4:
+			return 4u;
+		case bone_transform_format::affine_3x4:
+			return 3u;
+		case bone_transform_format::dual_quaternion:
+			return 2u;
+		default:
+			throw gvk::runtime_error("Unknown bone transform format value.");
+		}
+	}
+
+	/**	Writes the given bone matrix in the given format to the target memory, which must provide space
+	 *	for vec4s_per_bone_transform(aFormat) elements.
+	 */
+	static inline void store_bone_transform(const glm::mat4& aBoneMatrix, bone_transform_format aFormat, glm::vec4* aTarget)
+	{
+		switch (aFormat) {
+		case bone_transform_format::matrix_4x4:
+			std::copy(&aBoneMatrix[0], &aBoneMatrix[0] + 4, aTarget);
+			break;
+		case bone_transform_format::affine_3x4:
+		{
+			const auto rows = to_affine_3x4_rows(aBoneMatrix);
+			std::copy(std::begin(rows), std::end(rows), aTarget);
+			break;
+		}
+		case bone_transform_format::dual_quaternion:
+		{
+			const auto dq = to_dual_quaternion(aBoneMatrix);
+			aTarget[0] = glm::vec4{ dq.real.x, dq.real.y, dq.real.z, dq.real.w };
+			aTarget[1] = glm::vec4{ dq.dual.x, dq.dual.y, dq.dual.z, dq.dual.w };
+			break;
+		}
+		default:
+			throw gvk::runtime_error("Unknown bone transform format value.");
+		}
+	}
+
+	/**	Reads a bone transform which has been written in the given format (see store_bone_transform) and
+	 *	returns it as bone matrix. Dual quaternions are normalized before the conversion.
+	 */
+	static inline glm::mat4 load_bone_transform(const glm::vec4* aSource, bone_transform_format aFormat)
+	{
+		switch (aFormat) {
+		case bone_transform_format::matrix_4x4:
+			return glm::mat4{ aSource[0], aSource[1], aSource[2], aSource[3] };
+		case bone_transform_format::affine_3x4:
+			return glm::mat4{
+				glm::vec4{ aSource[0][0], aSource[1][0], aSource[2][0], 0.0f },
+				glm::vec4{ aSource[0][1], aSource[1][1], aSource[2][1], 0.0f },
+				glm::vec4{ aSource[0][2], aSource[1][2], aSource[2][2], 0.0f },
+				glm::vec4{ aSource[0][3], aSource[1][3], aSource[2][3], 1.0f }
+			};
+		case bone_transform_format::dual_quaternion:
+		{
+			const auto dq = glm::normalize(glm::dualquat{ glm::quat{ aSource[0].w, aSource[0].x, aSource[0].y, aSource[0].z }, glm::quat{ aSource[1].w, aSource[1].x, aSource[1].y, aSource[1].z } });
+			const glm::quat t = (dq.dual * 2.0f) * glm::conjugate(dq.real);
+			glm::mat4 result = glm::mat4_cast(dq.real);
+			result[3] = glm::vec4{ t.x, t.y, t.z, 1.0f };
+			return result;
+		}
+		default:
+			throw gvk::runtime_error("Unknown bone transform format value.");
+		}
+	}
+
+	/**	The bone transforms of an animation clip, sampled at a fixed rate and stored in one contiguous piece of
+	 *	memory, which can be uploaded to the GPU (e.g. via create_baked_animation_buffer) to play the animation
+	 *	back for any number of instances without any per-frame CPU animation work. Create it via animation::bake.
+	 *
+	 *	The data is stored frame by frame: frame f starts at element frame_offset(f), and contains
+	 *	mNumBones * vec4s_per_bone() elements, ordered like the bone matrices of animate_into_single_target_buffer.
+	 */
+	struct baked_animation
+	{
+		/** The animation clip which has been sampled; mStartTicks and mEndTicks are the times of the first and the last frame. */
+		unsigned int mAnimationIndex;
+		double mTicksPerSecond;
+		double mStartTicks;
+		double mEndTicks;
+
+		/** Format and space of the bone transforms in mData */
+		bone_transform_format mFormat;
+		bone_matrices_space mTargetSpace;
+
+		/** Number of frames per second of animation time */
+		double mFramesPerSecond;
+
+		/** The number of frames; at least 2 */
+		uint32_t mNumFrames;
+
+		/** The number of bones per frame */
+		uint32_t mNumBones;
+
+		/** mNumFrames * mNumBones * vec4s_per_bone() elements, see above */
+		std::vector<glm::vec4> mData;
+
+		/** The number of vec4 elements which one bone transform occupies in mData */
+		uint32_t vec4s_per_bone() const
+		{
+			return vec4s_per_bone_transform(mFormat);
+		}
+
+		/** Index of the first element of the given frame in mData */
+		size_t frame_offset(uint32_t aFrame) const
+		{
+			return static_cast<size_t>(aFrame) * mNumBones * vec4s_per_bone();
+		}
+
+		/** Returns the indices of the two frames surrounding the given time in seconds, and the interpolation factor between them */
+		std::tuple<uint32_t, uint32_t, float> frames_at(double aTime) const
+		{
+			const double framePos = glm::clamp((aTime - mStartTicks / mTicksPerSecond) * mFramesPerSecond, 0.0, static_cast<double>(mNumFrames - 1));
+			const auto frame1 = std::min(static_cast<uint32_t>(framePos), mNumFrames - 2u);
+			return std::make_tuple(frame1, frame1 + 1u, static_cast<float>(framePos - static_cast<double>(frame1)));
+		}
+
+		/** The size of mData in bytes */
+		size_t size_in_bytes() const
+		{
+			return sizeof(glm::vec4) * mData.size();
+		}
+	};
+
+	/**	An animation clip which has been resampled at a fixed rate into structure-of-arrays tracks.
+	 *	Create it via animation::resample_clip and pass it to animation::animate (or one of the
+	 *	animate_into_* methods) instead of the animation_clip_data that it has been created from.
+	 *
+	 *	The samples are stored frame by frame, i.e. the values of node n at sample s are stored at
+	 *	index [s * mNumNodes + n], s.t. the values which are needed for evaluating all nodes at one
+	 *	point in time, are located in two contiguous ranges of memory. Nodes which do not have
+	 *	any animation keys hold identity values.
+	 */
+	struct resampled_animation_clip
+	{
+		/** The same values as in the animation_clip_data which this clip has been created from */
+		unsigned int mAnimationIndex;
+		double mTicksPerSecond;
+		double mStartTicks;
+		double mEndTicks;
+
+		/** The number of animated nodes of the animation which this clip has been created from */
+		uint32_t mNumNodes;
+
+		/** The number of samples per node; at least 2 */
+		uint32_t mNumSamples;
+
+		/** Time in ticks between two consecutive samples */
+		double mTicksPerSample;
+
+		/** The time in ticks of each sample, relative to mStartTicks; mNumSamples entries */
+		std::vector<float> mTimes;
+
+		/** mNumSamples * mNumNodes entries each, see above */
+		std::vector<glm::vec3> mTranslations;
+		std::vector<glm::quat> mRotations;
+		std::vector<glm::vec3> mScales;
+
+		/** Returns the indices of the two samples surrounding the given time in ticks, and the interpolation factor between them */
+		std::tuple<size_t, size_t, float> samples_at(double aTimeInTicks) const
+		{
+			const double samplePos = glm::clamp((aTimeInTicks - mStartTicks) / mTicksPerSample, 0.0, static_cast<double>(mNumSamples - 1));
+			const auto sample1 = std::min(static_cast<size_t>(samplePos), static_cast<size_t>(mNumSamples - 2));
+			return std::make_tuple(sample1, sample1 + 1, static_cast<float>(samplePos - static_cast<double>(sample1)));
+		}
+
+		/** Returns the clip which this resampled clip has been created from */
+		animation_clip_data clip() const
+		{
+			return animation_clip_data{ mAnimationIndex, mTicksPerSecond, mStartTicks, mEndTicks };
+		}
+	};
+
+	/** Compact formats for unit quaternions, see quantize_rotation */
+	enum struct rotation_quantization
+	{
+		/** Rotations are not quantized; 16 bytes per rotation */
+		none,
+
+		/** "Smallest three" encoding in 32 bits: the index of the largest component (2 bits) and the
+		 *	other three components with 10 bits each. The maximum error is below 0.0045 radians.
+		 */
+		smallest_three_32bit,
+
+		/** "Smallest three" encoding in 48 bits: the index of the largest component (2 bits) and the
+		 *	other three components with 15 bits each. The maximum error is below 0.00015 radians.
+		 */
+		smallest_three_48bit,
+	};
+
+	/** The number of bytes which one rotation occupies in the given format */
+	static inline size_t bytes_per_rotation(rotation_quantization aQuantization)
+	{
+		switch (aQuantization) {
+		case rotation_quantization::none:
+			return sizeof(glm::quat);
+		case rotation_quantization::smallest_three_32bit:
+			return 4;
+		case rotation_quantization::smallest_three_48bit:
+			return 6;
+		default:
+			throw gvk::runtime_error("Unknown rotation quantization value.");
+		}
+	}
+
+	/** An upper bound of the angle (in radians) between a rotation and its quantized value in the given format */
+	static inline float max_rotation_quantization_error(rotation_quantization aQuantization)
+	{
+		switch (aQuantization) {
+		case rotation_quantization::none:
+			return 0.0f;
+		case rotation_quantization::smallest_three_32bit:
+			return 0.0045f;
+		case rotation_quantization::smallest_three_48bit:
+			return 0.00015f;
+		default:
+			throw gvk::runtime_error("Unknown rotation quantization value.");
+		}
+	}
+
+	/**	Encodes a unit quaternion in the given compact format. The result occupies the lowest
+	 *	8 * bytes_per_rotation(aQuantization) bits. Decode it with dequantize_rotation.
+	 */
+	extern uint64_t quantize_rotation(const glm::quat& aRotation, rotation_quantization aQuantization);
+
+	/** Decodes a rotation which has been encoded by quantize_rotation */
+	extern glm::quat dequantize_rotation(uint64_t aQuantized, rotation_quantization aQuantization);
+
+	/**	Error bounds and options for animation::compress_keys. The error bounds apply to the local
+	 *	transforms of the animated nodes, i.e. to the values of their keys.
+	 */
+	struct animation_compression_settings
+	{
+		/** Maximum distance between an original position key and the compressed position at its time */
+		float mMaxPositionError = 0.0001f;
+
+		/** Maximum angle (in radians) between an original rotation key and the compressed rotation at its time */
+		float mMaxRotationError = 0.0001f;
+
+		/** Maximum distance between an original scaling key and the compressed scaling at its time */
+		float mMaxScalingError = 0.0001f;
+
+		/** If set, all rotation keys are rounded to values which are exactly representable in the given
+		 *	format. This only reduces their precision: the keys stay glm::quat in memory, but can be stored
+		 *	in the compact format via quantize_rotation (e.g. in a file) without any further loss.
+		 *	The quantization error counts towards mMaxRotationError, which must therefore be at least
+		 *	max_rotation_quantization_error(mRotationQuantization); the default bound is not.
+		 */
+		rotation_quantization mRotationQuantization = rotation_quantization::none;
+	};
+
+	/** Statistics which are returned by animation::compress_keys */
+	struct animation_compression_stats
+	{
+		/** Total number of position, rotation, and scaling keys before and after compression */
+		size_t mKeysBefore = 0;
+		size_t mKeysAfter = 0;
+
+		/** Size of all keys in memory before and after compression, in bytes. Quantized rotation keys
+		 *	still occupy sizeof(glm::quat) each, see animation_compression_settings::mRotationQuantization.
+		 */
+		size_t mBytesBefore = 0;
+		size_t mBytesAfter = 0;
+
+		/** The maximum errors which occur at the times of the original keys, see animation_compression_settings */
+		float mMaxPositionError = 0.0f;
+		float mMaxRotationError = 0.0f;
+		float mMaxScalingError = 0.0f;
+
+		/** The ratio of the original size to the compressed size */
+		double compression_ratio() const
+		{
+			return 0 == mBytesAfter ? 1.0 : static_cast<double>(mBytesBefore) / static_cast<double>(mBytesAfter);
+		}
+	};
+
 	class model_t;
 
+	/**	Level of detail of one animation instance, see animation::set_lod
+	 */
+	struct animation_lod
+	{
+		/** The pose is evaluated only every mUpdateInterval-th frame, i.e. invocation of animate.
+		 *	1 means that it is evaluated every frame.
+		 */
+		uint32_t mUpdateInterval = 1u;
+
+		/** If true, the frames between two evaluations interpolate between the two most recently evaluated
+		 *	poses, which delays the animation by one update interval. If false, the most recently evaluated
+		 *	pose is repeated until the next evaluation.
+		 */
+		bool mInterpolate = true;
+
+		/** Indices of nodes (see animation::get_animated_node_at) whose whole subtrees shall not be animated,
+		 *	e.g. finger or face bones of distant characters. These nodes keep their unanimated local transforms.
+		 */
+		std::vector<size_t> mSkippedSubtrees;
+	};
+
+	static bool operator==(const animation_lod& left, const animation_lod& right)
+	{
+		return left.mUpdateInterval == right.mUpdateInterval && left.mInterpolate == right.mInterpolate && left.mSkippedSubtrees == right.mSkippedSubtrees;
+	}
+
+	static bool operator!=(const animation_lod& left, const animation_lod& right)
+	{
+		return !(left == right);
+	}
+
 	/**	Class that represents one specific animation for one or multiple meshes
 	 */
 	class animation
@@ -279,84 +643,55 @@ namespace gvk
 
 			double timeInTicks = aTime * aClip.mTicksPerSecond;
 
-			for (auto& anode : mAnimationData) {
-				// First, calculate the local transform
-				glm::mat4 localTransform = anode.mLocalTransform;
-
-				// The localTransform can only be different than the identity if there are animation keys.
-				if (anode.mPositionKeys.size() + anode.mRotationKeys.size() + anode.mScalingKeys.size() > 0) {
-					// Translation/position:
-					auto [tpos1, tpos2] = find_positions_in_keys(anode.mPositionKeys, timeInTicks);
-					auto tf = get_interpolation_factor(anode.mPositionKeys[tpos1], anode.mPositionKeys[tpos2], timeInTicks);
-					auto translation = glm::lerp(anode.mPositionKeys[tpos1].mValue, anode.mPositionKeys[tpos2].mValue, tf);
-
-					// Rotation:
-					size_t rpos1 = tpos1, rpos2 = tpos2;
-					if (!anode.mSameRotationAndPositionKeyTimes) {
-						std::tie(rpos1, rpos2) = find_positions_in_keys(anode.mRotationKeys, timeInTicks);
-					}
-					auto rf = get_interpolation_factor(anode.mRotationKeys[rpos1], anode.mRotationKeys[rpos2], timeInTicks);
-					auto rotation = glm::slerp(anode.mRotationKeys[rpos1].mValue, anode.mRotationKeys[rpos2].mValue, rf);	// use slerp, not lerp or mix (those lead to jerks)
-					rotation = glm::normalize(rotation); // normalize the resulting quaternion, just to be on the safe side
-
-					// Scaling:
-					size_t spos1 = tpos1, spos2 = tpos2;
-					if (!anode.mSameScalingAndPositionKeyTimes) {
-						std::tie(spos1, spos2) = find_positions_in_keys(anode.mScalingKeys, timeInTicks);
+			// First, interpolate the keys of all nodes (unless the LOD skips this frame or some of the nodes):
+			const auto n = mAnimationData.size();
+			const bool evaluate = begin_frame(n);
+			if (evaluate) {
+				for (size_t i = 0; i < n; ++i) {
+					auto& anode = mAnimationData[i];
+					if (is_animated(i)) {
+						std::tie(mScratchTranslations[i], mScratchRotations[i], mScratchScales[i]) = interpolate_keys(anode, timeInTicks, anode.mKeyCursors);
 					}
-					auto sf = get_interpolation_factor(anode.mScalingKeys[spos1], anode.mScalingKeys[spos2], timeInTicks);
-					auto scaling = glm::lerp(anode.mScalingKeys[spos1].mValue, anode.mScalingKeys[spos2].mValue, sf);
-
-					localTransform = matrix_from_transforms(translation, rotation, scaling);
 				}
+			}
 
-				// Calculate the node's global transform, using its local transform and the transforms of its parents:
-				if (anode.mAnimatedParentIndex.has_value()) {
-					anode.mGlobalTransform = mAnimationData[anode.mAnimatedParentIndex.value()].mGlobalTransform * anode.mParentTransform * localTransform;
-				}
-				else {
-					anode.mGlobalTransform = anode.mParentTransform * localTransform;
-				}
+			finish_frame(evaluate, timeInTicks, aBoneMatrixCalc);
+		}
 
-				// Calculate the final bone matrices for this node, for each mesh that is affected; and write out the matrix into the target storage:
-				const auto n = anode.mBoneMeshTargets.size();
-				for (size_t i = 0; i < n; ++i) {
-					// The final (mesh-specific!) bone matrix will be created in and stored via the lambda:
-					if constexpr (std::is_assignable<std::function<void(mesh_bone_info, const glm::mat4&, const glm::mat4&, const glm::mat4&)>, decltype(aBoneMatrixCalc)>::value) {
-						// Option 1: lambda that takes: mesh_bone_info, inverse mesh root matrix, global node/bone transform w.r.t. the animation, inverse bind-pose matrix
-						aBoneMatrixCalc(anode.mBoneMeshTargets[i].mMeshBoneInfo, anode.mBoneMeshTargets[i].mInverseMeshRootMatrix, anode.mGlobalTransform, anode.mBoneMeshTargets[i].mInverseBindPoseMatrix);
-					}
-				    else if constexpr (std::is_assignable<std::function<void(mesh_bone_info, const glm::mat4&, const glm::mat4&, const glm::mat4&, const glm::mat4&)>, decltype(aBoneMatrixCalc)>::value) {
-						// Option 2: lambda that takes: mesh_bone_info, inverse mesh root matrix, global node/bone transform w.r.t. the animation, inverse bind-pose matrix, local node/bone transformation
-				    	//           (The first four parameters are the same as with Option 1. Parameter five is passed in addition.)
-						aBoneMatrixCalc(anode.mBoneMeshTargets[i].mMeshBoneInfo, anode.mBoneMeshTargets[i].mInverseMeshRootMatrix, anode.mGlobalTransform, anode.mBoneMeshTargets[i].mInverseBindPoseMatrix, localTransform);
-				    }
-				    else if constexpr (std::is_assignable<std::function<void(mesh_bone_info, const glm::mat4&, const glm::mat4&, const glm::mat4&, const glm::mat4&, const animated_node&)>, decltype(aBoneMatrixCalc)>::value) {
-						// Option 3: lambda that takes: mesh_bone_info, inverse mesh root matrix, global node/bone transform w.r.t. the animation, inverse bind-pose matrix, local node/bone transformation, animated_node
-				    	//           (The first five parameters are the same as with Option 2. Parameter six is passed in addition.)
-						aBoneMatrixCalc(anode.mBoneMeshTargets[i].mMeshBoneInfo, anode.mBoneMeshTargets[i].mInverseMeshRootMatrix, anode.mGlobalTransform, anode.mBoneMeshTargets[i].mInverseBindPoseMatrix, localTransform, anode);
-				    }
-				    else if constexpr (std::is_assignable<std::function<void(mesh_bone_info, const glm::mat4&, const glm::mat4&, const glm::mat4&, const glm::mat4&, const animated_node&, size_t)>, decltype(aBoneMatrixCalc)>::value) {
-						// Option 4: lambda that takes: mesh_bone_info, inverse mesh root matrix, global node/bone transform w.r.t. the animation, inverse bind-pose matrix, local node/bone transformation, animated_node, bone mesh targets index
-				    	//           (The first six parameters are the same as with Option 3. Parameter seven is passed in addition.)
-						aBoneMatrixCalc(anode.mBoneMeshTargets[i].mMeshBoneInfo, anode.mBoneMeshTargets[i].mInverseMeshRootMatrix, anode.mGlobalTransform, anode.mBoneMeshTargets[i].mInverseBindPoseMatrix, localTransform, anode, i);
-				    }
-				    else if constexpr (std::is_assignable<std::function<void(mesh_bone_info, const glm::mat4&, const glm::mat4&, const glm::mat4&, const glm::mat4&, const animated_node&, size_t, double)>, decltype(aBoneMatrixCalc)>::value) {
-						// Option 4: lambda that takes: mesh_bone_info, inverse mesh root matrix, global node/bone transform w.r.t. the animation, inverse bind-pose matrix, local node/bone transformation, animated_node, bone mesh targets index, animation time in ticks
-				    	//           (The first seven parameters are the same as with Option 4. Parameter eight is passed in addition.)
-						aBoneMatrixCalc(anode.mBoneMeshTargets[i].mMeshBoneInfo, anode.mBoneMeshTargets[i].mInverseMeshRootMatrix, anode.mGlobalTransform, anode.mBoneMeshTargets[i].mInverseBindPoseMatrix, localTransform, anode, i, timeInTicks);
-				    }
-					else {
-#if defined(_MSC_VER) && defined(__cplusplus)
-						static_assert(false);
-#else
-						assert(false);
-#endif
-						throw avk::logic_error("No lambda has been passed to animation::animate.");
-					}
-					
-				}
+		/**	Same as the animate overload which takes an animation_clip_data, but samples a clip which has been
+		 *	resampled into uniform tracks via resample_clip. No keys have to be searched, because the samples
+		 *	surrounding aTime are found by a direct index computation. aTime is clamped to the clip's range.
+		 *
+		 *	@param	aClip				Resampled animation clip, which must have been created by this animation
+		 *	@param	aTime				Time in seconds to calculate the bone matrices at.
+		 *	@param	aBoneMatrixCalc		Callback-function which receives the matrices, see the animate overload which takes an animation_clip_data.
+		 */
+		template <typename F>
+		void animate(const resampled_animation_clip& aClip, double aTime, F&& aBoneMatrixCalc)
+		{
+			if (aClip.mAnimationIndex != mAnimationIndex || aClip.mNumNodes != mAnimationData.size()) {
+				throw gvk::runtime_error("The passed resampled_animation_clip has not been created from this animation.");
 			}
+
+			const double timeInTicks = glm::clamp(aTime * aClip.mTicksPerSecond, aClip.mStartTicks, aClip.mEndTicks);
+			const auto [sample1, sample2, factor] = aClip.samples_at(timeInTicks);
+			const auto* translations1 = aClip.mTranslations.data() + sample1 * aClip.mNumNodes;
+			const auto* translations2 = aClip.mTranslations.data() + sample2 * aClip.mNumNodes;
+			const auto* rotations1 = aClip.mRotations.data() + sample1 * aClip.mNumNodes;
+			const auto* rotations2 = aClip.mRotations.data() + sample2 * aClip.mNumNodes;
+			const auto* scales1 = aClip.mScales.data() + sample1 * aClip.mNumNodes;
+			const auto* scales2 = aClip.mScales.data() + sample2 * aClip.mNumNodes;
+
+			// All nodes share the same interpolation factor => blend them in bulk:
+			const auto n = mAnimationData.size();
+			const bool evaluate = begin_frame(n);
+			if (evaluate) {
+				lerp_vectors(translations1, translations2, factor, mScratchTranslations.data(), n);
+				blend_rotations(rotations1, rotations2, factor, mScratchRotations.data(), n);
+				lerp_vectors(scales1, scales2, factor, mScratchScales.data(), n);
+			}
+
+			finish_frame(evaluate, timeInTicks, aBoneMatrixCalc);
 		}
 
 		/** Convenience-overload to animation::animate which calculates the bone animation s.t. a vertex transformed
@@ -415,11 +750,100 @@ namespace gvk
 		 */
 		void animate_into_single_target_buffer(const animation_clip_data& aClip, double aTime, bone_matrices_space aTargetSpace, glm::mat4* aTargetMemory);
 
+		/** Same as animate_into_strided_target_per_mesh, but samples the given resampled clip. */
+		void animate_into_strided_target_per_mesh(const resampled_animation_clip& aClip, double aTime, bone_matrices_space aTargetSpace, glm::mat4* aTargetMemory, size_t aMeshStride, std::optional<size_t> aMatricesStride = {}, std::optional<size_t> aMaxMeshes = {}, std::optional<size_t> aMaxBonesPerMesh = {});
+
+		/** Same as animate_into_single_target_buffer, but samples the given resampled clip. */
+		void animate_into_single_target_buffer(const resampled_animation_clip& aClip, double aTime, bone_matrices_space aTargetSpace, glm::mat4* aTargetMemory);
+
+		/**	Same as animate_into_strided_target_per_mesh, but writes the bone transforms in the given format instead
+		 *	of as 4x4 matrices, which reduces the memory and bandwidth per bone (see bone_transform_format).
+		 *
+		 *	@param	aFormat				The format to write the bone transforms in
+		 *	@param	aTargetMemory		Pointer to the memory location where the first bone transform shall be written to
+		 *	@param	aMeshStride			Stride (in bytes) between the bone transforms of subsequent meshes
+		 *	@param	aTransformsStride	Stride (in bytes) between subsequent bone transforms of one mesh; by default, they are tightly packed
+		 */
+		void animate_into_strided_target_per_mesh(const animation_clip_data& aClip, double aTime, bone_matrices_space aTargetSpace, bone_transform_format aFormat, glm::vec4* aTargetMemory, size_t aMeshStride, std::optional<size_t> aTransformsStride = {}, std::optional<size_t> aMaxMeshes = {}, std::optional<size_t> aMaxBonesPerMesh = {});
+
+		/** Same as above, but samples the given resampled clip. */
+		void animate_into_strided_target_per_mesh(const resampled_animation_clip& aClip, double aTime, bone_matrices_space aTargetSpace, bone_transform_format aFormat, glm::vec4* aTargetMemory, size_t aMeshStride, std::optional<size_t> aTransformsStride = {}, std::optional<size_t> aMaxMeshes = {}, std::optional<size_t> aMaxBonesPerMesh = {});
+
+		/**	Same as animate_into_single_target_buffer, but writes the bone transforms in the given format instead
+		 *	of as 4x4 matrices. Bone transform i starts at element i * vec4s_per_bone_transform(aFormat) of aTargetMemory.
+		 *	For dual quaternions, the vertex shader must blend them in the same hemisphere (see skin_position).
+		 *
+		 *	@param	aFormat				The format to write the bone transforms in
+		 *	@param	aTargetMemory		Pointer to the memory location where the first bone transform shall be written to
+		 */
+		void animate_into_single_target_buffer(const animation_clip_data& aClip, double aTime, bone_matrices_space aTargetSpace, bone_transform_format aFormat, glm::vec4* aTargetMemory);
+
+		/** Same as above, but samples the given resampled clip. */
+		void animate_into_single_target_buffer(const resampled_animation_clip& aClip, double aTime, bone_matrices_space aTargetSpace, bone_transform_format aFormat, glm::vec4* aTargetMemory);
+
+		/**	Resamples the given clip of this animation into uniform structure-of-arrays tracks.
+		 *	Sampling them during animate does not require any searching for keys, and their memory is
+		 *	accessed linearly. The resampled clip approximates the original keys; use a sample rate
+		 *	which is at least as high as the key rate of the original clip for good results.
+		 *
+		 *	@param	aClip				Animation clip to resample, e.g. retrieved via model_t::load_animation_clip
+		 *	@param	aSamplesPerSecond	The number of samples per second of animation time
+		 */
+		resampled_animation_clip resample_clip(const animation_clip_data& aClip, double aSamplesPerSecond) const;
+
+		/**	Bakes the bone transforms of the given clip into one contiguous buffer. The clip is sampled at a
+		 *	fixed rate over the range of its keys (see animation_key_times_within_clip), s.t. the first and the
+		 *	last frame are exactly at the first and the last key. This animation instance is not modified.
+		 *
+		 *	@param	aClip				Animation clip to bake
+		 *	@param	aFramesPerSecond	The number of frames per second of animation time
+		 *	@param	aFormat				The format to store the bone transforms in
+		 *	@param	aTargetSpace		The space of the bone transforms, see animate_into_single_target_buffer
+		 */
+		baked_animation bake(const animation_clip_data& aClip, double aFramesPerSecond, bone_transform_format aFormat, bone_matrices_space aTargetSpace = bone_matrices_space::mesh_space) const;
+
+		/**	Removes all keys which can be reproduced by interpolating between their remaining neighbours
+		 *	within the given error bounds, separately for the position, rotation, and scaling keys of each
+		 *	node, and optionally quantizes the rotation keys. This reduces the memory footprint of the keys
+		 *	and the number of keys which have to be searched during animate. Bounds are only guaranteed
+		 *	within the time range of each node's keys (before the first and after the last key, the
+		 *	keys are extrapolated). Compress before copying the animation for multiple instances, and
+		 *	(re)create resampled clips and baked animations afterwards.
+		 *
+		 *	@param	aSettings			The error bounds and the rotation format. Throws a gvk::logic_error if
+		 *								mMaxRotationError is below the error of the requested quantization.
+		 *	@return	The achieved compression and the maximum errors
+		 */
+		animation_compression_stats compress_keys(const animation_compression_settings& aSettings = {});
+
 		/**	Returns all the unique keyframe time-values of the given animation.
 		 *	@param	aClip				Animation clip which to extract the unique keyframe time-values from
 		 */
 		std::vector<double> animation_key_times_within_clip(const animation_clip_data& aClip) const;
 
+		/**	Returns the number of bone matrices which animate_into_single_target_buffer writes, i.e. the
+		 *	number of elements which its target memory must provide.
+		 */
+		size_t number_of_bone_matrices() const;
+
+		/**	Sets the level of detail of this animation instance. It determines how often the pose is evaluated
+		 *	and which nodes are animated at all. The next invocation of animate evaluates the pose.
+		 */
+		void set_lod(animation_lod aLod);
+
+		/** Returns the current level of detail of this animation instance */
+		const animation_lod& lod() const { return mLod; }
+
+		/**	Sets a hook which selects the level of detail from a distance, e.g. the distance between the camera
+		 *	and the animated character. It is invoked by update_lod_for_distance. See also distance_based_lod_selector.
+		 */
+		void set_lod_selector(std::function<animation_lod(float)> aSelector);
+
+		/**	Selects the level of detail for the given distance via the hook which has been set with set_lod_selector.
+		 *	The level of detail is only changed if the hook returns a different one than the current one.
+		 */
+		void update_lod_for_distance(float aDistance);
+
 		/** Returns the total number of animated nodes stored in an animation */
 		size_t number_of_animated_nodes() const;
 		
@@ -449,25 +873,234 @@ namespace gvk
 		std::vector<std::reference_wrapper<animated_node>> get_child_nodes_of(size_t aNodeIndex);
 		
 	private:
+		/** Returns true if the given node has any animation keys. Nodes without keys always use their mLocalTransform. */
+		static bool has_keys(const animated_node& aNode)
+		{
+			return aNode.mPositionKeys.size() + aNode.mRotationKeys.size() + aNode.mScalingKeys.size() > 0;
+		}
+
+		/** True if the node at the given index is animated, i.e. if it has keys and is not skipped by the LOD. */
+		bool is_animated(size_t aNodeIndex) const
+		{
+			return has_keys(mAnimationData[aNodeIndex]) && (mSkippedNodes.empty() || 0 == mSkippedNodes[aNodeIndex]);
+		}
+
+		/** Returns the local transform which has been determined for the node at the given index during the current frame. */
+		const glm::mat4& local_transform_of(size_t aNodeIndex) const
+		{
+			return is_animated(aNodeIndex) ? mScratchLocalTransforms[aNodeIndex] : mAnimationData[aNodeIndex].mLocalTransform;
+		}
+
+		/**	Resizes the scratch buffers to the given number of nodes. Nodes without keys get identity transforms,
+		 *	s.t. the bulk operations can process all nodes without producing any invalid values.
+		 */
+		void resize_scratch_buffers(size_t aNumNodes)
+		{
+			if (mScratchLocalTransforms.size() == aNumNodes) {
+				return;
+			}
+			mScratchTranslations.assign(aNumNodes, glm::vec3{ 0.0f });
+			mScratchRotations.assign(aNumNodes, glm::quat{ 1.0f, 0.0f, 0.0f, 0.0f });
+			mScratchScales.assign(aNumNodes, glm::vec3{ 1.0f });
+			mScratchLocalTransforms.resize(aNumNodes);
+			mHasPose = false;
+		}
+
+		/**	Starts a frame of animate and returns true if the pose has to be evaluated in it (into mScratchTranslations,
+		 *	mScratchRotations, and mScratchScales), or false if the LOD skips this frame.
+		 */
+		bool begin_frame(size_t aNumNodes)
+		{
+			resize_scratch_buffers(aNumNodes);
+			if (mHasPose && mLodFrame + 1 < mLod.mUpdateInterval) {
+				++mLodFrame;
+				return false;
+			}
+			mLodFrame = 0;
+			if (mHasPose && mLod.mUpdateInterval > 1u && mLod.mInterpolate) {
+				// Keep the most recently evaluated pose, in order to interpolate from it towards the new one:
+				mPreviousTranslations = mScratchTranslations;
+				mPreviousRotations = mScratchRotations;
+				mPreviousScales = mScratchScales;
+			}
+			return true;
+		}
+
+		/**	Finishes a frame of animate: builds the local transforms from the evaluated (or interpolated) pose,
+		 *	concatenates them with their parents' transforms, and invokes the bone matrix callback.
+		 */
+		template <typename F>
+		void finish_frame(bool aPoseEvaluated, double timeInTicks, F& aBoneMatrixCalc)
+		{
+			const auto n = mAnimationData.size();
+			const bool interpolate = mLod.mUpdateInterval > 1u && mLod.mInterpolate;
+			if (aPoseEvaluated && !mHasPose) {
+				mHasPose = true;
+				if (interpolate) {
+					// There is no previous pose yet => interpolate from the new pose to itself:
+					mPreviousTranslations = mScratchTranslations;
+					mPreviousRotations = mScratchRotations;
+					mPreviousScales = mScratchScales;
+				}
+			}
+
+			if (!aPoseEvaluated && !interpolate) {
+				// The pose is the same as in the previous frame => pass its transforms to the callback again:
+				for (size_t i = 0; i < n; ++i) {
+					invoke_bone_matrix_callback(mAnimationData[i], local_transform_of(i), timeInTicks, aBoneMatrixCalc);
+				}
+				return;
+			}
+
+			const glm::vec3* translations = mScratchTranslations.data();
+			const glm::quat* rotations = mScratchRotations.data();
+			const glm::vec3* scales = mScratchScales.data();
+			if (interpolate) {
+				const float factor = static_cast<float>(mLodFrame) / static_cast<float>(mLod.mUpdateInterval);
+				mInterpolatedTranslations.resize(n);
+				mInterpolatedRotations.resize(n);
+				mInterpolatedScales.resize(n);
+				lerp_vectors(mPreviousTranslations.data(), mScratchTranslations.data(), factor, mInterpolatedTranslations.data(), n);
+				blend_rotations(mPreviousRotations.data(), mScratchRotations.data(), factor, mInterpolatedRotations.data(), n);
+				lerp_vectors(mPreviousScales.data(), mScratchScales.data(), factor, mInterpolatedScales.data(), n);
+				translations = mInterpolatedTranslations.data();
+				rotations = mInterpolatedRotations.data();
+				scales = mInterpolatedScales.data();
+			}
+			compose_affine_transforms(translations, rotations, scales, mScratchLocalTransforms.data(), n);
+
+			for (size_t i = 0; i < n; ++i) {
+				update_global_transform_and_invoke(mAnimationData[i], local_transform_of(i), timeInTicks, aBoneMatrixCalc);
+			}
+		}
+
+		/**	Interpolates the translation, rotation, and scaling keys of the given node at the given time,
+		 *	using (and updating) the given key cursors. The node must have keys, see has_keys.
+		 */
+		std::tuple<glm::vec3, glm::quat, glm::vec3> interpolate_keys(const animated_node& anode, double timeInTicks, animation_key_cursors& aCursors) const
+		{
+			// Translation/position:
+			auto [tpos1, tpos2] = find_positions_in_keys(anode.mPositionKeys, timeInTicks, aCursors.mPosition);
+			auto tf = get_interpolation_factor(anode.mPositionKeys[tpos1], anode.mPositionKeys[tpos2], timeInTicks);
+			auto translation = glm::lerp(anode.mPositionKeys[tpos1].mValue, anode.mPositionKeys[tpos2].mValue, tf);
+
+			// Rotation:
+			size_t rpos1 = tpos1, rpos2 = tpos2;
+			if (!anode.mSameRotationAndPositionKeyTimes) {
+				std::tie(rpos1, rpos2) = find_positions_in_keys(anode.mRotationKeys, timeInTicks, aCursors.mRotation);
+			}
+			auto rf = get_interpolation_factor(anode.mRotationKeys[rpos1], anode.mRotationKeys[rpos2], timeInTicks);
+			auto rotation = glm::slerp(anode.mRotationKeys[rpos1].mValue, anode.mRotationKeys[rpos2].mValue, rf);	// use slerp, not lerp or mix (those lead to jerks)
+			rotation = glm::normalize(rotation); // normalize the resulting quaternion, just to be on the safe side
+
+			// Scaling:
+			size_t spos1 = tpos1, spos2 = tpos2;
+			if (!anode.mSameScalingAndPositionKeyTimes) {
+				std::tie(spos1, spos2) = find_positions_in_keys(anode.mScalingKeys, timeInTicks, aCursors.mScaling);
+			}
+			auto sf = get_interpolation_factor(anode.mScalingKeys[spos1], anode.mScalingKeys[spos2], timeInTicks);
+			auto scaling = glm::lerp(anode.mScalingKeys[spos1].mValue, anode.mScalingKeys[spos2].mValue, sf);
+
+			return std::make_tuple(translation, rotation, scaling);
+		}
+
+		/**	Calculates the given node's global transform from its local transform and its parent's global
+		 *	transform, and invokes the bone matrix callback for each of its mesh targets.
+		 *	See animate for the callback signatures which are supported.
+		 */
+		template <typename F>
+		void update_global_transform_and_invoke(animated_node& anode, const glm::mat4& localTransform, double timeInTicks, F& aBoneMatrixCalc)
+		{
+			// Calculate the node's global transform, using its local transform and the transforms of its parents.
+			// Parents precede their children in mAnimationData, hence the parent's global transform is up to date:
+			if (anode.mAnimatedParentIndex.has_value()) {
+				assert(&mAnimationData[anode.mAnimatedParentIndex.value()] < &anode);
+				anode.mGlobalTransform = multiply_transforms(mAnimationData[anode.mAnimatedParentIndex.value()].mGlobalTransform, multiply_transforms(anode.mParentTransform, localTransform));
+			}
+			else {
+				anode.mGlobalTransform = multiply_transforms(anode.mParentTransform, localTransform);
+			}
+
+			invoke_bone_matrix_callback(anode, localTransform, timeInTicks, aBoneMatrixCalc);
+		}
+
+		/**	Invokes the bone matrix callback for each of the given node's mesh targets, passing the node's current global transform.
+		 *	See animate for the callback signatures which are supported.
+		 */
+		template <typename F>
+		void invoke_bone_matrix_callback(const animated_node& anode, const glm::mat4& localTransform, double timeInTicks, F& aBoneMatrixCalc)
+		{
+			// Calculate the final bone matrices for this node, for each mesh that is affected; and write out the matrix into the target storage:
+			const auto n = anode.mBoneMeshTargets.size();
+			for (size_t i = 0; i < n; ++i) {
+				// The final (mesh-specific!) bone matrix will be created in and stored via the lambda:
+				if constexpr (std::is_assignable<std::function<void(mesh_bone_info, const glm::mat4&, const glm::mat4&, const glm::mat4&)>, decltype(aBoneMatrixCalc)>::value) {
+					// Option 1: lambda that takes: mesh_bone_info, inverse mesh root matrix, global node/bone transform w.r.t. the animation, inverse bind-pose matrix
+					aBoneMatrixCalc(anode.mBoneMeshTargets[i].mMeshBoneInfo, anode.mBoneMeshTargets[i].mInverseMeshRootMatrix, anode.mGlobalTransform, anode.mBoneMeshTargets[i].mInverseBindPoseMatrix);
+				}
+			    else if constexpr (std::is_assignable<std::function<void(mesh_bone_info, const glm::mat4&, const glm::mat4&, const glm::mat4&, const glm::mat4&)>, decltype(aBoneMatrixCalc)>::value) {
+					// Option 2: lambda that takes: mesh_bone_info, inverse mesh root matrix, global node/bone transform w.r.t. the animation, inverse bind-pose matrix, local node/bone transformation
+			    	//           (The first four parameters are the same as with Option 1. Parameter five is passed in addition.)
+					aBoneMatrixCalc(anode.mBoneMeshTargets[i].mMeshBoneInfo, anode.mBoneMeshTargets[i].mInverseMeshRootMatrix, anode.mGlobalTransform, anode.mBoneMeshTargets[i].mInverseBindPoseMatrix, localTransform);
+			    }
+			    else if constexpr (std::is_assignable<std::function<void(mesh_bone_info, const glm::mat4&, const glm::mat4&, const glm::mat4&, const glm::mat4&, const animated_node&)>, decltype(aBoneMatrixCalc)>::value) {
+					// Option 3: lambda that takes: mesh_bone_info, inverse mesh root matrix, global node/bone transform w.r.t. the animation, inverse bind-pose matrix, local node/bone transformation, animated_node
+			    	//           (The first five parameters are the same as with Option 2. Parameter six is passed in addition.)
+					aBoneMatrixCalc(anode.mBoneMeshTargets[i].mMeshBoneInfo, anode.mBoneMeshTargets[i].mInverseMeshRootMatrix, anode.mGlobalTransform, anode.mBoneMeshTargets[i].mInverseBindPoseMatrix, localTransform, anode);
+			    }
+			    else if constexpr (std::is_assignable<std::function<void(mesh_bone_info, const glm::mat4&, const glm::mat4&, const glm::mat4&, const glm::mat4&, const animated_node&, size_t)>, decltype(aBoneMatrixCalc)>::value) {
+					// Option 4: lambda that takes: mesh_bone_info, inverse mesh root matrix, global node/bone transform w.r.t. the animation, inverse bind-pose matrix, local node/bone transformation, animated_node, bone mesh targets index
+			    	//           (The first six parameters are the same as with Option 3. Parameter seven is passed in addition.)
+					aBoneMatrixCalc(anode.mBoneMeshTargets[i].mMeshBoneInfo, anode.mBoneMeshTargets[i].mInverseMeshRootMatrix, anode.mGlobalTransform, anode.mBoneMeshTargets[i].mInverseBindPoseMatrix, localTransform, anode, i);
+			    }
+			    else if constexpr (std::is_assignable<std::function<void(mesh_bone_info, const glm::mat4&, const glm::mat4&, const glm::mat4&, const glm::mat4&, const animated_node&, size_t, double)>, decltype(aBoneMatrixCalc)>::value) {
+					// Option 4: lambda that takes: mesh_bone_info, inverse mesh root matrix, global node/bone transform w.r.t. the animation, inverse bind-pose matrix, local node/bone transformation, animated_node, bone mesh targets index, animation time in ticks
+			    	//           (The first seven parameters are the same as with Option 4. Parameter eight is passed in addition.)
+					aBoneMatrixCalc(anode.mBoneMeshTargets[i].mMeshBoneInfo, anode.mBoneMeshTargets[i].mInverseMeshRootMatrix, anode.mGlobalTransform, anode.mBoneMeshTargets[i].mInverseBindPoseMatrix, localTransform, anode, i, timeInTicks);
+			    }
+				else {
+#if defined(_MSC_VER) && defined(__cplusplus)
+					static_assert(false);
+#else
+					assert(false);
+#endif
+					throw avk::logic_error("No lambda has been passed to animation::animate.");
+				}
+				
+			}
+		}
+
 		/** Helper function used during animate() to find two positions of key-elements
-		 *	between which the given aTime lies.
+		 *	between which the given aTime lies. The first position is the last key whose
+		 *	mTime is <= aTime (or 0 if there is none), the second one is the key after it
+		 *	(or the same if there is none).
+		 *
+		 *	aCursor is the first position which has been found during the previous invocation.
+		 *	It is checked first, then its successor, and only if aTime lies in neither of their
+		 *	intervals (i.e. after a seek or a wrap-around), the keys are binary-searched.
+		 *	aCursor is updated to the new first position.
 		 */
 		template <typename T>
-		std::tuple<size_t, size_t> find_positions_in_keys(const T& aCollection, double aTime) const
+		std::tuple<size_t, size_t> find_positions_in_keys(const T& aCollection, double aTime, size_t& aCursor) const
 		{
 			const auto maxIndex = aCollection.size() - 1;
-			
-			size_t pos1 = 0;
-			while (pos1 + 1 <= maxIndex && aCollection[pos1 + 1].mTime <= aTime) {
-				++pos1;
+			auto isFirstKeyOfInterval = [&aCollection, aTime, maxIndex](size_t aPos) {
+				return (0 == aPos || aCollection[aPos].mTime <= aTime) && (aPos == maxIndex || aCollection[aPos + 1].mTime > aTime);
+			};
+
+			size_t pos1 = std::min(aCursor, maxIndex);
+			if (!isFirstKeyOfInterval(pos1)) {
+				if (pos1 < maxIndex && isFirstKeyOfInterval(pos1 + 1)) {
+					++pos1;
+				}
+				else {
+					const auto it = std::upper_bound(std::begin(aCollection), std::end(aCollection), aTime, [](double aT, const auto& aKey) { return aT < aKey.mTime; });
+					pos1 = std::begin(aCollection) == it ? 0 : static_cast<size_t>(std::distance(std::begin(aCollection), it)) - 1;
+				}
 			}
-			
+			aCursor = pos1;
+
 			size_t pos2 = pos1 + (pos1 < maxIndex ? 1 : 0);
-			while (pos2 + 1 < maxIndex && aCollection[pos2 + 1].mTime < aTime) {
-				LOG_WARNING(fmt::format("Now that's strange: keys[{}].mTime {} < {}, despite keys[{}].mTime {} <= {}", pos2 + 1, aCollection[pos2 + 1].mTime, aTime, pos1, aCollection[pos1].mTime, aTime));
-				++pos2;
-			}
-			
 			return std::make_tuple(pos1, pos2);
 		}
 
@@ -499,10 +1132,100 @@ namespace gvk
 		 */
 		size_t mMaxNumBoneMatrices;
 
+		/** Per-instance scratch memory for the local transforms of all nodes and their components, which
+		 *	are calculated in bulk during animate (see animation_kernels.hpp). Not serialized.
+		 */
+		std::vector<glm::vec3> mScratchTranslations;
+		std::vector<glm::quat> mScratchRotations;
+		std::vector<glm::vec3> mScratchScales;
+		std::vector<glm::mat4> mScratchLocalTransforms;
+
+		/** Level of detail state of this instance, see set_lod. Not serialized. */
+		animation_lod mLod;
+		std::function<animation_lod(float)> mLodSelector;
+		/** One entry per node, which is 1 if the node is part of one of mLod.mSkippedSubtrees; empty if none are skipped. */
+		std::vector<uint8_t> mSkippedNodes;
+		/** Number of frames since the pose has been evaluated the last time */
+		uint32_t mLodFrame = 0u;
+		/** True if the scratch buffers contain an evaluated pose */
+		bool mHasPose = false;
+		/** The pose which has been evaluated before the most recent one, and the one interpolated between them */
+		std::vector<glm::vec3> mPreviousTranslations;
+		std::vector<glm::quat> mPreviousRotations;
+		std::vector<glm::vec3> mPreviousScales;
+		std::vector<glm::vec3> mInterpolatedTranslations;
+		std::vector<glm::quat> mInterpolatedRotations;
+		std::vector<glm::vec3> mInterpolatedScales;
+
 		/** Make serialize a friend, so the serializer can access private data members.
 		 *  (see custom serialization functions in serializer.hpp)
 		 */
 		template<typename Archive>
 		friend void serialize(Archive& aArchive, gvk::animation& aValue);
 	};
+
+	/**	Creates a hook for animation::set_lod_selector which picks the level of detail by distance.
+	 *	@param	aLevels		Pairs of minimum distance and level of detail: For a given distance, the level with the
+	 *						greatest minimum distance which is not greater than that distance is selected. For
+	 *						distances closer than all of them, the full level of detail is used.
+	 */
+	extern std::function<animation_lod(float)> distance_based_lod_selector(std::vector<std::tuple<float, animation_lod>> aLevels);
+
+	/**	One animation instance which shall be evaluated by animate_into_single_target_buffer_in_parallel */
+	struct animation_batch_entry
+	{
+		/** The animation instance to evaluate. Every instance may be contained at most once per batch. */
+		animation* mAnimation;
+
+		/** The clip to evaluate */
+		animation_clip_data mClip;
+
+		/** Time in seconds to calculate the bone matrices at */
+		double mTime;
+
+		/** If set, this resampled clip is sampled instead of mClip. It must have been created by mAnimation. */
+		const resampled_animation_clip* mResampledClip = nullptr;
+	};
+
+	/**	Evaluates many animation instances in parallel on worker threads (see parallel_for) and writes the bone
+	 *	matrices of all of them into one shared target. Entry i writes into its own region, which starts at the
+	 *	sum of animation::number_of_bone_matrices() of all entries before it. The results are exactly the same
+	 *	as if animation::animate_into_single_target_buffer was invoked for each entry with the start of its region.
+	 *
+	 *	@param	aEntries			The animation instances to evaluate
+	 *	@param	aTargetSpace		The target space into which the vertices shall be transformed by multiplying them with the bone matrices
+	 *	@param	aTargetMemory		Pointer to the memory location where the first bone matrix of the first entry shall be written to
+	 *	@param	aMaxThreads			Maximum number of threads to use, see parallel_for
+	 *	@return	The offset (in bone matrices) of each entry's region within aTargetMemory
+	 */
+	extern std::vector<size_t> animate_into_single_target_buffer_in_parallel(std::span<const animation_batch_entry> aEntries, bone_matrices_space aTargetSpace, glm::mat4* aTargetMemory, uint32_t aMaxThreads = 0);
+
+	/**	Same as above, but writes the bone transforms in the given format instead of as 4x4 matrices.
+	 *	@return	The offset (in bone transforms, not in vec4 elements) of each entry's region within aTargetMemory
+	 */
+	extern std::vector<size_t> animate_into_single_target_buffer_in_parallel(std::span<const animation_batch_entry> aEntries, bone_matrices_space aTargetSpace, bone_transform_format aFormat, glm::vec4* aTargetMemory, uint32_t aMaxThreads = 0);
+
+	/**	CPU reference implementation of skinning, intended for validating GPU skinning, and bone transforms in
+	 *	the different formats against each other. Matrix formats are blended linearly; dual quaternions are
+	 *	blended linearly in the hemisphere of the first bone (i.e. dual quaternion linear blending) and normalized.
+	 *
+	 *	@param	aPosition			The vertex position in bind pose
+	 *	@param	aBoneIndices		Indices of (up to) four bones into aBoneTransforms, e.g. from model_t::bone_indices_for_mesh_for_single_target_buffer
+	 *	@param	aBoneWeights		Their weights, which should sum up to one; bones with zero weight are ignored.
+	 *								If all of them are zero, dual quaternions leave the position unchanged.
+	 *	@param	aBoneTransforms		The bone transforms, e.g. written by animation::animate_into_single_target_buffer
+	 *	@param	aFormat				The format of aBoneTransforms
+	 *	@return	The skinned vertex position
+	 */
+	extern glm::vec3 skin_position(const glm::vec3& aPosition, const glm::uvec4& aBoneIndices, const glm::vec4& aBoneWeights, const glm::vec4* aBoneTransforms, bone_transform_format aFormat);
+
+	/** Same as skin_position, but for a normal (or any other direction), which is normalized after skinning.
+	 *	Non-uniform scaling in bone matrices is not compensated for.
+	 */
+	extern glm::vec3 skin_normal(const glm::vec3& aNormal, const glm::uvec4& aBoneIndices, const glm::vec4& aBoneWeights, const glm::vec4* aBoneTransforms, bone_transform_format aFormat);
+
+	/**	Skins all vertices of a mesh via skin_position, e.g. to compare its results with the results of GPU skinning.
+	 *	aBoneIndices and aBoneWeights must contain one element per position.
+	 */
+	extern std::vector<glm::vec3> skin_positions(std::span<const glm::vec3> aPositions, std::span<const glm::uvec4> aBoneIndices, std::span<const glm::vec4> aBoneWeights, const glm::vec4* aBoneTransforms, bone_transform_format aFormat);
 }
@@ -0,0 +1,71 @@
+#pragma once
+#include <gvk.hpp>
+
+namespace gvk
+{
+	/**	Rotations whose (absolute) dot product is at least this value are blended by a normalized linear
+	 *	interpolation instead of a spherical one. At this threshold, the angular error of the blended
+	 *	rotation is at most about 1.02e-6 radians, and it decreases with the cube of the angle between them.
+	 */
+	static constexpr float sNlerpThreshold = 0.9995f;
+
+	/**	Blends pairs of rotations along the shortest path: rotations which are close to each other (see
+	 *	sNlerpThreshold) are blended by a normalized linear interpolation, all others by a spherical linear
+	 *	interpolation. The results are normalized. Processes four rotations per iteration if SSE2 is available.
+	 *	@param	aFrom		The rotations at aFactor == 0
+	 *	@param	aTo			The rotations at aFactor == 1
+	 *	@param	aFactor		Interpolation factor, which is the same for all of the aCount pairs
+	 *	@param	aResult		Target memory for aCount rotations; may be the same as aFrom or aTo
+	 */
+	extern void blend_rotations(const glm::quat* aFrom, const glm::quat* aTo, float aFactor, glm::quat* aResult, size_t aCount);
+
+	/**	Linearly interpolates pairs of vectors (like glm::lerp) with the same factor for all of them.
+	 *	@param	aResult		Target memory for aCount vectors; may be the same as aFrom or aTo
+	 */
+	extern void lerp_vectors(const glm::vec3* aFrom, const glm::vec3* aTo, float aFactor, glm::vec3* aResult, size_t aCount);
+
+	/**	Builds the affine matrices translation * rotation * scale directly from their components, i.e.
+	 *	without any 4x4 matrix multiplications. Processes four matrices per iteration if SSE2 is available.
+	 *	@param	aRotations	Unit quaternions
+	 *	@param	aResult		Target memory for aCount matrices
+	 */
+	extern void compose_affine_transforms(const glm::vec3* aTranslations, const glm::quat* aRotations, const glm::vec3* aScales, glm::mat4* aResult, size_t aCount);
+
+	/** True if the last row of the given matrix is (0, 0, 0, 1), i.e. if it can be passed to multiply_affine. */
+	static inline bool is_affine(const glm::mat4& aMatrix)
+	{
+		return aMatrix[0][3] == 0.0f && aMatrix[1][3] == 0.0f && aMatrix[2][3] == 0.0f && aMatrix[3][3] == 1.0f;
+	}
+
+	/**	Returns aA * aB for two affine matrices (see is_affine), which is cheaper than a general 4x4 multiplication. */
+	static inline glm::mat4 multiply_affine(const glm::mat4& aA, const glm::mat4& aB)
+	{
+		glm::mat4 result;
+#if defined(GVK_SSE2)
+		const __m128 a0 = _mm_loadu_ps(&aA[0][0]);
+		const __m128 a1 = _mm_loadu_ps(&aA[1][0]);
+		const __m128 a2 = _mm_loadu_ps(&aA[2][0]);
+		for (int c = 0; c < 4; ++c) {
+			__m128 col = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a0, _mm_set1_ps(aB[c][0])), _mm_mul_ps(a1, _mm_set1_ps(aB[c][1]))), _mm_mul_ps(a2, _mm_set1_ps(aB[c][2])));
+			if (3 == c) {
+				col = _mm_add_ps(col, _mm_loadu_ps(&aA[3][0]));
+			}
+			_mm_storeu_ps(&result[c][0], col);
+		}
+#else
+		for (int c = 0; c < 4; ++c) {
+			result[c] = aA[0] * aB[c][0] + aA[1] * aB[c][1] + aA[2] * aB[c][2];
+		}
+		result[3] += aA[3];
+#endif
+		return result;
+	}
+
+	/**	Returns aA * aB, computed via multiply_affine if both matrices are affine (which node transforms and
+	 *	bone matrices usually are), or via a general 4x4 matrix multiplication otherwise.
+	 */
+	static inline glm::mat4 multiply_transforms(const glm::mat4& aA, const glm::mat4& aB)
+	{
+		return is_affine(aA) && is_affine(aB) ? multiply_affine(aA, aB) : aA * aB;
+	}
+}
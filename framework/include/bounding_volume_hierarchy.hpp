@@ -0,0 +1,279 @@
+#pragma once
+#include <gvk.hpp>
+
+namespace gvk
+{
+	/** A primitive which has been found by a query of a bounding_volume_hierarchy, and its distance */
+	struct bvh_hit
+	{
+		uint32_t mPrimitive;
+		float mDistance;
+	};
+
+	/**	Intersects a ray with an axis-aligned box (slab test).
+	 *	@param	aInverseDirection	1 / direction of the ray, component-wise
+	 *	@param	aMaxDistance		Intersections farther away than this are not reported
+	 *	@param	aEntryDistance		Is set to the distance at which the ray enters the box, or to 0 if its origin is inside
+	 *	@return	True if the ray intersects the box between 0 and aMaxDistance
+	 */
+	static inline bool intersect_ray_box(const glm::vec3& aOrigin, const glm::vec3& aInverseDirection, const aabb& aBox, float aMaxDistance, float& aEntryDistance)
+	{
+		if (aBox.is_empty()) {
+			return false;
+		}
+		float entry = 0.f;
+		float exit = aMaxDistance;
+		for (int i = 0; i < 3; ++i) {
+			const float t0 = (aBox.mMin[i] - aOrigin[i]) * aInverseDirection[i];
+			const float t1 = (aBox.mMax[i] - aOrigin[i]) * aInverseDirection[i];
+			// The order of the arguments ensures that NaNs (origin on a slab and direction parallel to it) are ignored:
+			entry = std::max(entry, std::min(t0, t1));
+			exit = std::min(exit, std::max(t0, t1));
+		}
+		aEntryDistance = entry;
+		return entry <= exit;
+	}
+
+	/** Returns the squared distance of the given point to the given box, which is 0 if the point is inside */
+	static inline float squared_distance_to_box(const glm::vec3& aPoint, const aabb& aBox)
+	{
+		const glm::vec3 d = glm::max(glm::max(aBox.mMin - aPoint, aPoint - aBox.mMax), glm::vec3{ 0.f });
+		return glm::dot(d, d);
+	}
+
+	/**	A bounding volume hierarchy over axis-aligned boxes of arbitrary primitives (e.g. model instances),
+	 *	which accelerates frustum queries, ray queries, and nearest-primitive queries.
+	 *	Primitives are identified by their index in the span which the hierarchy has been built from.
+	 *
+	 *	The hierarchy is built with the surface area heuristic (SAH), evaluated for a fixed number of bins per axis.
+	 *	Large subtrees are built on multiple threads; the result does not depend on the number of threads.
+	 *	When primitives move, their bounds can be updated (see set_primitive_bounds) and the hierarchy can be
+	 *	refitted (see refit), which is much cheaper than rebuilding it, but the quality of the hierarchy
+	 *	deteriorates if the primitives move far. Compare sah_cost to the cost after the last build to decide
+	 *	when to rebuild.
+	 */
+	class bounding_volume_hierarchy
+	{
+	public:
+		/** Marks a node which has no childs, and the root node's parent */
+		static constexpr uint32_t sNoNode = std::numeric_limits<uint32_t>::max();
+		/** Number of bins per axis which split candidates are evaluated for */
+		static constexpr uint32_t sNumBins = 16;
+		/** Leaves contain at most this many primitives, even if the SAH would prefer larger leaves */
+		static constexpr uint32_t sMaxLeafPrimitives = 8;
+		/** Subtrees with at most this many primitives are built as separate tasks, in parallel */
+		static constexpr uint32_t sParallelTaskPrimitives = 4096;
+
+		/**	A node of the hierarchy. The primitives of every node's subtree are stored contiguously (see
+		 *	primitive_indices), and the childs of inner nodes are stored next to each other.
+		 */
+		struct node
+		{
+			aabb mBounds;
+			/** Index of the first child; the second child is at mFirstChild + 1. sNoNode for leaves. */
+			uint32_t mFirstChild;
+			/** Range of this node's primitives within primitive_indices */
+			uint32_t mFirstPrimitive;
+			uint32_t mNumPrimitives;
+
+			bool is_leaf() const { return sNoNode == mFirstChild; }
+		};
+
+		bounding_volume_hierarchy() = default;
+		bounding_volume_hierarchy(bounding_volume_hierarchy&&) noexcept = default;
+		bounding_volume_hierarchy(const bounding_volume_hierarchy&) = default;
+		bounding_volume_hierarchy& operator=(bounding_volume_hierarchy&&) noexcept = default;
+		bounding_volume_hierarchy& operator=(const bounding_volume_hierarchy&) = default;
+		~bounding_volume_hierarchy() = default;
+
+		/**	Builds the hierarchy from scratch.
+		 *	@param	aBounds			The bounds of all primitives; primitive i has the bounds aBounds[i]. Empty boxes are
+		 *							allowed, but primitives with empty bounds are never reported by any query.
+		 *	@param	aMaxThreads		Maximum number of threads to use. If 0, the value of `gvk::max_worker_threads()` is used.
+		 */
+		void build(std::span<const aabb> aBounds, uint32_t aMaxThreads = 0);
+
+		/** The number of primitives the hierarchy has been built from */
+		size_t number_of_primitives() const { return mPrimitiveIndices.size(); }
+		/** All nodes; the root node is at index 0 */
+		std::span<const node> nodes() const { return mNodes; }
+		/** The primitive indices in the order of the leaves, see node::mFirstPrimitive */
+		std::span<const uint32_t> primitive_indices() const { return mPrimitiveIndices; }
+		/** Gets the current bounds of the given primitive */
+		const aabb& primitive_bounds(uint32_t aPrimitive) const { return mOrderedBounds[mPrimitiveSlots[aPrimitive]]; }
+		/** The bounds of all primitives */
+		aabb bounds() const { return mNodes.empty() ? aabb{} : mNodes[0].mBounds; }
+
+		/**	Sets new bounds for the given primitive, and marks the nodes which contain it as outdated.
+		 *	Call refit after all changes, before the next query.
+		 */
+		void set_primitive_bounds(uint32_t aPrimitive, const aabb& aBounds);
+
+		/** Updates the bounds of the nodes which have been marked as outdated by set_primitive_bounds. */
+		void refit();
+
+		/**	Sets new bounds for all primitives and updates the bounds of all nodes, while keeping the structure.
+		 *	@param	aBounds		Must contain as many boxes as the hierarchy has been built from.
+		 */
+		void refit(std::span<const aabb> aBounds);
+
+		/** True if primitive bounds have been changed by set_primitive_bounds since the last refit */
+		bool needs_refit() const { return mNeedsRefit; }
+
+		/**	The expected cost of a query (in units of box tests) according to the surface area heuristic.
+		 *	It increases when the hierarchy is refitted after the primitives moved.
+		 */
+		float sah_cost() const;
+
+		/**	Gathers the indices of all primitives whose boxes are inside of the given frustum or intersect it.
+		 *	Subtrees which are entirely inside of the frustum are gathered without testing their primitives.
+		 *	@param	aResult		Is cleared, then filled with the primitive indices (in no particular order).
+		 *						Pass the same vector every frame to avoid reallocations.
+		 */
+		void query_frustum(const frustum& aFrustum, std::vector<uint32_t>& aResult) const;
+
+		/**	Finds the primitive which is hit first by the given ray, according to the given intersection function.
+		 *	Nodes are visited from near to far, and nodes which are farther away than the closest hit so far are skipped.
+		 *	@param	aDirection		Direction of the ray; distances are in units of its length.
+		 *	@param	aMaxDistance	Hits which are farther away than this are not reported
+		 *	@param	aIntersect		Function with the signature std::optional<float>(uint32_t aPrimitive, float aBoxDistance)
+		 *							which is invoked for every primitive whose box is hit by the ray, before aMaxDistance and
+		 *							before the closest hit so far. It returns the distance of the intersection with the
+		 *							actual primitive (e.g., with its triangles), or an empty optional if it is not hit.
+		 *	@return	The primitive which has been hit first and the distance reported for it, or an empty optional
+		 */
+		template <typename F>
+		std::optional<bvh_hit> closest_hit(const glm::vec3& aOrigin, const glm::vec3& aDirection, float aMaxDistance, F aIntersect) const
+		{
+			std::optional<bvh_hit> result;
+			const glm::vec3 inverseDirection = 1.f / aDirection;
+			float entry;
+			if (mNodes.empty() || !intersect_ray_box(aOrigin, inverseDirection, mNodes[0].mBounds, aMaxDistance, entry)) {
+				return result;
+			}
+			float closest = aMaxDistance;
+			std::vector<std::tuple<uint32_t, float>> stack{ { 0u, entry } };
+			while (!stack.empty()) {
+				const auto [nodeIndex, nodeEntry] = stack.back();
+				stack.pop_back();
+				if (nodeEntry > closest) {
+					continue;
+				}
+				const auto& n = mNodes[nodeIndex];
+				if (n.is_leaf()) {
+					for (uint32_t slot = n.mFirstPrimitive; slot < n.mFirstPrimitive + n.mNumPrimitives; ++slot) {
+						if (!intersect_ray_box(aOrigin, inverseDirection, mOrderedBounds[slot], closest, entry)) {
+							continue;
+						}
+						const auto distance = aIntersect(mPrimitiveIndices[slot], entry);
+						if (distance.has_value() && *distance <= closest) {
+							closest = *distance;
+							result = bvh_hit{ mPrimitiveIndices[slot], *distance };
+						}
+					}
+					continue;
+				}
+				float entries[2];
+				const bool hits[2] = {
+					intersect_ray_box(aOrigin, inverseDirection, mNodes[n.mFirstChild].mBounds, closest, entries[0]),
+					intersect_ray_box(aOrigin, inverseDirection, mNodes[n.mFirstChild + 1].mBounds, closest, entries[1])
+				};
+				// Push the farther child first, s.t. the nearer one is visited first:
+				const int nearer = hits[0] && hits[1] ? (entries[1] < entries[0] ? 1 : 0) : (hits[0] ? 0 : 1);
+				if (hits[1 - nearer]) {
+					stack.emplace_back(n.mFirstChild + 1 - nearer, entries[1 - nearer]);
+				}
+				if (hits[nearer]) {
+					stack.emplace_back(n.mFirstChild + nearer, entries[nearer]);
+				}
+			}
+			return result;
+		}
+
+		/**	Finds the primitive whose box is hit first by the given ray. The reported distance is where the ray enters the box.
+		 *	Use the overload with an intersection function to test the ray against the actual primitives.
+		 */
+		std::optional<bvh_hit> closest_hit(const glm::vec3& aOrigin, const glm::vec3& aDirection, float aMaxDistance = std::numeric_limits<float>::max()) const
+		{
+			return closest_hit(aOrigin, aDirection, aMaxDistance, [](uint32_t, float aBoxDistance) { return std::optional<float>{ aBoxDistance }; });
+		}
+
+		/**	Finds the primitive whose box is closest to the given point.
+		 *	@param	aMaxDistance	Primitives which are farther away than this are not reported
+		 *	@return	The closest primitive and the distance of the point to its box (which is 0 if the point is inside),
+		 *			or an empty optional if no primitive is within aMaxDistance
+		 */
+		std::optional<bvh_hit> nearest(const glm::vec3& aPoint, float aMaxDistance = std::numeric_limits<float>::max()) const;
+
+	private:
+		/**	Builds the subtree of the given node of aNodes, whose primitive range must already be set.
+		 *	If aTasks is set, nodes with at most sParallelTaskPrimitives primitives are not built, but added to aTasks instead.
+		 *	Only modifies the node's range of mPrimitiveIndices, s.t. disjoint subtrees can be built concurrently.
+		 */
+		void build_subtree(std::vector<node>& aNodes, uint32_t aRoot, std::span<const aabb> aBounds, std::span<const glm::vec3> aCentroids, std::vector<uint32_t>* aTasks);
+
+		std::vector<node> mNodes;
+		/** Parent node index of each node, or sNoNode for the root */
+		std::vector<uint32_t> mParentIndices;
+		/** Set for nodes whose bounds are outdated */
+		std::vector<uint8_t> mOutdated;
+		/** Primitive indices in the order of the leaves */
+		std::vector<uint32_t> mPrimitiveIndices;
+		/** Bounds of the primitives in the order of mPrimitiveIndices */
+		std::vector<aabb> mOrderedBounds;
+		/** Position of every primitive within mPrimitiveIndices */
+		std::vector<uint32_t> mPrimitiveSlots;
+		/** Leaf node index for every position within mPrimitiveIndices */
+		std::vector<uint32_t> mLeafIndices;
+		bool mNeedsRefit = false;
+	};
+
+	/** Identifies an instance of a model of an ORCA scene */
+	struct orca_instance_index
+	{
+		uint32_t mModelIndex;
+		uint32_t mInstanceIndex;
+	};
+
+	/**	A bounding volume hierarchy over the world-space boxes of all model instances of an ORCA scene
+	 *	(see orca_scene_t::bounds_of_instances). Run queries on bvh() and map the primitives they return to
+	 *	instances via instance(), e.g. to determine the visible instances of large scenes, or to pick instances
+	 *	with the mouse.
+	 */
+	class orca_scene_bvh
+	{
+	public:
+		orca_scene_bvh() = default;
+		/** Builds the hierarchy over all instances of the given scene, see build */
+		orca_scene_bvh(const orca_scene_t& aScene, uint32_t aMaxThreads = 0) { build(aScene, aMaxThreads); }
+
+		/**	(Re)builds the hierarchy over all instances of all models of the given scene. Rebuild it whenever instances
+		 *	are added or removed, or after many instances moved far.
+		 */
+		void build(const orca_scene_t& aScene, uint32_t aMaxThreads = 0);
+
+		/**	Updates the box of the given instance after its translation, rotation, or scaling has been changed in
+		 *	the scene. Call refit after all changes, before the next query.
+		 */
+		void update_instance(const orca_scene_t& aScene, size_t aModelIndex, size_t aInstanceIndex);
+
+		/** Updates the hierarchy after instances have been updated, see update_instance */
+		void refit() { mBvh.refit(); }
+
+		/** The hierarchy, whose primitives can be mapped to instances via instance */
+		const bounding_volume_hierarchy& bvh() const { return mBvh; }
+
+		/** Returns the instance which the given primitive of bvh() represents */
+		const orca_instance_index& instance(uint32_t aPrimitive) const { return mInstances[aPrimitive]; }
+
+		/** Returns the primitive of bvh() which represents the given instance */
+		uint32_t primitive(size_t aModelIndex, size_t aInstanceIndex) const { return mFirstPrimitiveOfModel[aModelIndex] + static_cast<uint32_t>(aInstanceIndex); }
+
+	private:
+		bounding_volume_hierarchy mBvh;
+		std::vector<orca_instance_index> mInstances;
+		std::vector<uint32_t> mFirstPrimitiveOfModel;
+		/** Model-space box of each model, i.e. of all its meshes */
+		std::vector<aabb> mModelBounds;
+	};
+}
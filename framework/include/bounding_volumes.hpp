@@ -0,0 +1,160 @@
+#pragma once
+#include <gvk.hpp>
+
+namespace gvk
+{
+	/**	An axis-aligned bounding box. A box which does not contain anything (see is_empty) has
+	 *	mMin = +max float and mMax = -max float, s.t. it does not change a box it is merged with.
+	 */
+	struct aabb
+	{
+		glm::vec3 mMin{ std::numeric_limits<float>::max() };
+		glm::vec3 mMax{ -std::numeric_limits<float>::max() };
+
+		bool is_empty() const { return mMin.x > mMax.x || mMin.y > mMax.y || mMin.z > mMax.z; }
+		glm::vec3 center() const { return (mMin + mMax) * 0.5f; }
+		glm::vec3 extent() const { return (mMax - mMin) * 0.5f; }
+	};
+
+	/** A bounding sphere. An empty sphere has a negative radius. */
+	struct bounding_sphere
+	{
+		glm::vec3 mCenter{ 0.f };
+		float mRadius = -1.f;
+
+		bool is_empty() const { return mRadius < 0.f; }
+	};
+
+	/**	An oriented bounding box, i.e. a box around mCenter, whose sides are aligned with the (orthonormal)
+	 *	columns of mAxes and which extends by mHalfExtents[i] along mAxes[i] in both directions.
+	 */
+	struct oriented_bounding_box
+	{
+		glm::vec3 mCenter{ 0.f };
+		glm::mat3 mAxes{ 1.f };
+		glm::vec3 mHalfExtents{ 0.f };
+	};
+
+	/** Axis-aligned box and sphere which both enclose the same geometry */
+	struct mesh_bounds
+	{
+		aabb mBox;
+		bounding_sphere mSphere;
+	};
+
+	/** Returns the smallest axis-aligned box which contains all the given points, or an empty box if there are none */
+	extern aabb bounding_box_of_points(std::span<const glm::vec3> aPoints);
+
+	/**	Returns a sphere which contains all the given points, or an empty sphere if there are none.
+	 *	It is computed with Ritter's algorithm (which is usually within a few percent of the optimal sphere),
+	 *	unless the sphere around the points' bounding box center is tighter.
+	 */
+	extern bounding_sphere bounding_sphere_of_points(std::span<const glm::vec3> aPoints);
+
+	/**	Returns an oriented box which contains all the given points. Its axes are the principal components of the
+	 *	points (i.e. the eigenvectors of their covariance matrix). If the axis-aligned bounding box has a smaller
+	 *	volume, that is returned with identity axes instead.
+	 */
+	extern oriented_bounding_box oriented_bounding_box_of_points(std::span<const glm::vec3> aPoints);
+
+	/** Returns the axis-aligned box and the sphere of the given points */
+	static inline mesh_bounds bounds_of_points(std::span<const glm::vec3> aPoints)
+	{
+		return mesh_bounds{ bounding_box_of_points(aPoints), bounding_sphere_of_points(aPoints) };
+	}
+
+	/** Returns the smallest axis-aligned box which contains both boxes */
+	static inline aabb merged(const aabb& aA, const aabb& aB)
+	{
+		return aabb{ glm::min(aA.mMin, aB.mMin), glm::max(aA.mMax, aB.mMax) };
+	}
+
+	/** Returns the smallest sphere which contains both spheres */
+	static inline bounding_sphere merged(const bounding_sphere& aA, const bounding_sphere& aB)
+	{
+		if (aA.is_empty()) { return aB; }
+		if (aB.is_empty()) { return aA; }
+		const glm::vec3 offset = aB.mCenter - aA.mCenter;
+		const float distance = glm::length(offset);
+		if (distance + aB.mRadius <= aA.mRadius) { return aA; }
+		if (distance + aA.mRadius <= aB.mRadius) { return aB; }
+		const float radius = (distance + aA.mRadius + aB.mRadius) * 0.5f;
+		return bounding_sphere{ aA.mCenter + offset * ((radius - aA.mRadius) / distance), radius };
+	}
+
+	/** Returns the box and the sphere which contain both of the given bounds' boxes and spheres, respectively */
+	static inline mesh_bounds merged(const mesh_bounds& aA, const mesh_bounds& aB)
+	{
+		return mesh_bounds{ merged(aA.mBox, aB.mBox), merged(aA.mSphere, aB.mSphere) };
+	}
+
+	/** Returns the axis-aligned box which contains the given box after it has been transformed by the given affine matrix */
+	static inline aabb transformed(const aabb& aBox, const glm::mat4& aMatrix)
+	{
+		if (aBox.is_empty()) {
+			return aBox;
+		}
+		// Transform the center, and project the extent onto the world axes (Arvo's method):
+		const glm::mat3 linear{ aMatrix };
+		const glm::vec3 center = glm::vec3{ aMatrix * glm::vec4{ aBox.center(), 1.f } };
+		const glm::vec3 extent = glm::abs(linear[0]) * aBox.extent().x + glm::abs(linear[1]) * aBox.extent().y + glm::abs(linear[2]) * aBox.extent().z;
+		return aabb{ center - extent, center + extent };
+	}
+
+	/** Returns the sphere which contains the given sphere after it has been transformed by the given affine matrix */
+	static inline bounding_sphere transformed(const bounding_sphere& aSphere, const glm::mat4& aMatrix)
+	{
+		if (aSphere.is_empty()) {
+			return aSphere;
+		}
+		const float maxScale = std::max({ glm::length(glm::vec3{ aMatrix[0] }), glm::length(glm::vec3{ aMatrix[1] }), glm::length(glm::vec3{ aMatrix[2] }) });
+		return bounding_sphere{ glm::vec3{ aMatrix * glm::vec4{ aSphere.mCenter, 1.f } }, aSphere.mRadius * maxScale };
+	}
+
+	/** Returns the given bounds after they have been transformed by the given affine matrix */
+	static inline mesh_bounds transformed(const mesh_bounds& aBounds, const glm::mat4& aMatrix)
+	{
+		return mesh_bounds{ transformed(aBounds.mBox, aMatrix), transformed(aBounds.mSphere, aMatrix) };
+	}
+
+	/**	Returns an oriented box which contains the given oriented box after it has been transformed by the given
+	 *	affine matrix. The result's axes are the transformed box axes, orthonormalized (Gram-Schmidt); its half
+	 *	extents are grown s.t. it encloses all the transformed corners. It is therefore exact for matrices which
+	 *	keep the box' axes orthogonal (rotations, translations, uniform scaling, and scaling along the box' axes),
+	 *	and conservative for all others, e.g. for non-uniform scaling along other axes.
+	 */
+	static inline oriented_bounding_box transformed(const oriented_bounding_box& aBox, const glm::mat4& aMatrix)
+	{
+		const glm::mat3 linear{ aMatrix };
+		oriented_bounding_box result;
+		result.mCenter = glm::vec3{ aMatrix * glm::vec4{ aBox.mCenter, 1.f } };
+
+		glm::vec3 axis0 = linear * aBox.mAxes[0];
+		const float length0 = glm::length(axis0);
+		axis0 = length0 > 0.f ? axis0 / length0 : aBox.mAxes[0];
+		glm::vec3 axis1 = linear * aBox.mAxes[1];
+		axis1 -= glm::dot(axis1, axis0) * axis0;
+		const float length1 = glm::length(axis1);
+		if (length1 > 1e-3f * length0) {
+			// Orthogonalize a second time to remove the cancellation error of the first pass:
+			axis1 /= length1;
+			axis1 = glm::normalize(axis1 - glm::dot(axis1, axis0) * axis0);
+		}
+		else { // The matrix (nearly) collapses the first two axes onto one => take any direction orthogonal to axis0
+			axis1 = glm::normalize(glm::cross(axis0, std::abs(axis0.x) < 0.9f ? glm::vec3{ 1.f, 0.f, 0.f } : glm::vec3{ 0.f, 1.f, 0.f }));
+		}
+		result.mAxes = glm::mat3{ axis0, axis1, glm::cross(axis0, axis1) };
+
+		// The transformed box is the parallelepiped spanned by these half edges around the center; its extent
+		// along each of the new axes is the sum of the half edges' projections onto it:
+		const glm::vec3 halfEdges[3] = {
+			linear * (aBox.mAxes[0] * aBox.mHalfExtents[0]),
+			linear * (aBox.mAxes[1] * aBox.mHalfExtents[1]),
+			linear * (aBox.mAxes[2] * aBox.mHalfExtents[2])
+		};
+		for (int i = 0; i < 3; ++i) {
+			result.mHalfExtents[i] = std::abs(glm::dot(result.mAxes[i], halfEdges[0])) + std::abs(glm::dot(result.mAxes[i], halfEdges[1])) + std::abs(glm::dot(result.mAxes[i], halfEdges[2]));
+		}
+		return result;
+	}
+}
@@ -86,6 +86,10 @@ namespace gvk
 		// both matrices combined together.
 		glm::mat4 projection_and_view_matrix() const;
 
+		// Returns the view volume of this camera in world space, i.e. the frustum planes of
+		// projection_and_view_matrix(). Works for perspective and orthographic projections.
+		frustum view_frustum() const;
+
 	protected:
 		void update_projection_matrix();
 
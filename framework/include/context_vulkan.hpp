@@ -82,6 +82,11 @@ namespace gvk
 		 */
 		avk::command_pool& get_command_pool_for_resettable_command_buffers(const avk::queue& aQueue);
 
+		/**	Get the staging ring from which the buffer and image upload helpers (e.g. create_image_from_file
+		 *	or create_normals_buffer) sub-allocate their staging memory.
+		 */
+		staging_ring& upload_staging_ring() { return mUploadStagingRing; }
+
 		avk::queue& create_queue(vk::QueueFlags aRequiredFlags = {}, avk::queue_selection_preference aQueueSelectionPreference = avk::queue_selection_preference::versatile_queue, window* aPresentSupportForWindow = nullptr, float aQueuePriority = 0.5f);
 		
 		/**	Creates a new window, but does not open it. Set the window's parameters
@@ -223,6 +228,8 @@ namespace gvk
 		vk::PhysicalDeviceVulkan12Features mRequestedVulkan12DeviceFeatures;
 
 		std::deque<avk::queue> mQueues;
+
+		staging_ring mUploadStagingRing;
 	};
 
 }
@@ -0,0 +1,91 @@
+#pragma once
+#include <gvk.hpp>
+
+namespace gvk
+{
+	/**	A view volume, represented by six planes. Each plane is stored as (normal, distance) with a normalized
+	 *	normal which points into the volume, i.e. a point p is on the inner side of a plane if
+	 *	dot(plane.xyz, p) + plane.w >= 0.
+	 */
+	struct frustum
+	{
+		/** Order of the planes in mPlanes; left/right and bottom/top are the planes at clip space x and y = -w/+w */
+		enum plane_index { left_plane = 0, right_plane, bottom_plane, top_plane, near_plane, far_plane };
+
+		std::array<glm::vec4, 6> mPlanes;
+	};
+
+	/**	Extracts the frustum planes from a combined projection and view matrix (e.g. camera::projection_and_view_matrix),
+	 *	which works for perspective and orthographic projections alike. The planes are in the space which the matrix
+	 *	transforms from, i.e. world space for projection * view, or object space for projection * view * model.
+	 *	Clip space is expected to follow the Vulkan conventions, i.e. depth ranges from 0 to w.
+	 */
+	extern frustum frustum_from_matrix(const glm::mat4& aProjectionAndViewMatrix);
+
+	/**	Bounding spheres in structure of arrays layout, i.e. one array per component.
+	 *	All spans must have the same size.
+	 */
+	struct bounding_spheres_soa
+	{
+		std::span<const float> mCenterX;
+		std::span<const float> mCenterY;
+		std::span<const float> mCenterZ;
+		std::span<const float> mRadius;
+	};
+
+	/**	Axis-aligned bounding boxes in structure of arrays layout, i.e. one array per component.
+	 *	All spans must have the same size.
+	 */
+	struct bounding_boxes_soa
+	{
+		std::span<const float> mMinX;
+		std::span<const float> mMinY;
+		std::span<const float> mMinZ;
+		std::span<const float> mMaxX;
+		std::span<const float> mMaxY;
+		std::span<const float> mMaxZ;
+	};
+
+	/** Returns true if the given sphere is inside of the frustum or intersects it. This is also the scalar reference for cull_spheres. */
+	static inline bool is_sphere_visible(const frustum& aFrustum, const glm::vec3& aCenter, float aRadius)
+	{
+		for (const auto& plane : aFrustum.mPlanes) {
+			if (plane.x * aCenter.x + plane.y * aCenter.y + plane.z * aCenter.z + plane.w < -aRadius) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/**	Returns true if the given axis-aligned box is inside of the frustum or intersects it. This is also the scalar
+	 *	reference for cull_boxes. Boxes which are outside but close to a corner of the frustum may be reported as visible.
+	 */
+	static inline bool is_box_visible(const frustum& aFrustum, const glm::vec3& aMin, const glm::vec3& aMax)
+	{
+		const glm::vec3 center = (aMin + aMax) * 0.5f;
+		const glm::vec3 extent = (aMax - aMin) * 0.5f;
+		for (const auto& plane : aFrustum.mPlanes) {
+			// Distance of the box' center and the box' extent projected onto the plane's normal:
+			const float distance = plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w;
+			const float radius = std::abs(plane.x) * extent.x + std::abs(plane.y) * extent.y + std::abs(plane.z) * extent.z;
+			if (distance < -radius) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/**	Tests all the given spheres against the frustum and gathers the indices of the visible ones (inside or intersecting).
+	 *	Processes four spheres per iteration if SSE2 is available; the results are the same as is_sphere_visible's.
+	 *	@param	aVisibleIndices		Is cleared, then filled with the indices of the visible spheres in ascending order.
+	 *								Pass the same vector every frame to avoid reallocations.
+	 */
+	extern void cull_spheres(const frustum& aFrustum, const bounding_spheres_soa& aSpheres, std::vector<uint32_t>& aVisibleIndices);
+
+	/**	Tests all the given axis-aligned boxes against the frustum and gathers the indices of the visible ones (inside or
+	 *	intersecting). Processes four boxes per iteration if SSE2 is available; the results are the same as is_box_visible's.
+	 *	@param	aVisibleIndices		Is cleared, then filled with the indices of the visible boxes in ascending order.
+	 *								Pass the same vector every frame to avoid reallocations.
+	 */
+	extern void cull_boxes(const frustum& aFrustum, const bounding_boxes_soa& aBoxes, std::vector<uint32_t>& aVisibleIndices);
+}
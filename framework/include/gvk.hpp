@@ -26,6 +26,7 @@
 #include <typeinfo>
 #include <atomic>
 #include <mutex>
+#include <thread>
 #include <condition_variable>
 #include <cstdlib>
 #include <typeindex>
@@ -34,8 +35,10 @@
 #include <cstdint>
 #include <chrono>
 #include <filesystem>
+#include <span>
 
 #include <cstdio>
+#include <cstring>
 #include <cassert>
 
 // ----------------------- externals -----------------------
@@ -44,6 +47,8 @@
 #include <fmt/ostream.h>
 #include <fmt/chrono.h>
 #include <stb_image.h>
+#include <stb_image_resize.h>
+#include <stb_dxt.h>
 
 #include <assimp/Importer.hpp>  // C++ importer interface
 #include <assimp/scene.h>       // Output data structure
@@ -62,6 +67,13 @@
 // We need to configure it to use the Vulkan range of 0.0 to 1.0 using the GLM_FORCE_DEPTH_ZERO_TO_ONE definition. [1]
 #define GLM_FORCE_DEPTH_ZERO_TO_ONE
 
+// SSE2 code paths of the CPU-side kernels (e.g. animation blending, frustum culling) are enabled whenever
+// the target supports SSE2, which is always the case for x64:
+#if defined(_M_X64) || defined(__SSE2__)
+#define GVK_SSE2
+#include <emmintrin.h>
+#endif
+
 #define GLM_FORCE_RADIANS
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
@@ -79,6 +91,7 @@
 #include <glm/gtx/transform2.hpp>
 #include <glm/gtx/hash.hpp>
 #include <glm/gtx/compatibility.hpp>
+#include <glm/gtx/dual_quaternion.hpp>
 
 #include <gli/load.hpp> // load DDS, KTX or KMG textures from files or memory.
 #include <gli/core/flip.hpp>
@@ -118,6 +131,7 @@
 #include "context_generic_glfw.hpp"
 
 #include "math_utils.hpp"
+#include "parallel_for.hpp"
 #include "key_code.hpp"
 #include "key_state.hpp"
 #include "timer_frame_type.hpp"
@@ -130,6 +144,7 @@
 #include "vk_convenience_functions.hpp"
 
 #include "settings.hpp"
+#include "staging_ring.hpp"
 #include "context_vulkan.hpp"
 
 namespace gvk
@@ -187,6 +202,8 @@ namespace gvk {
 #include "sequential_invoker.hpp"
 
 #include "transform.hpp"
+#include "frustum.hpp"
+#include "bounding_volumes.hpp"
 #include "camera.hpp"
 #include "quake_camera.hpp"
 #include "material_config.hpp"
@@ -195,10 +212,15 @@ namespace gvk {
 #include "lightsource.hpp"
 #include "lightsource_gpu_data.hpp"
 #include "model_types.hpp"
+#include "mesh_optimization.hpp"
+#include "animation_kernels.hpp"
 #include "animation.hpp"
 #include "model.hpp"
 #include "orca_scene.hpp"
+#include "scene_graph.hpp"
+#include "bounding_volume_hierarchy.hpp"
 #include "serializer.hpp"
+#include "upload_batch.hpp"
 #include "material_image_helpers.hpp"
 
 #include "composition.hpp"
@@ -3,25 +3,38 @@
 
 namespace gvk
 {
+	/**	Records a copy from a staging ring allocation into one MIP level of an image, which must be in
+	 *	vk::ImageLayout::eTransferDstOptimal. The caller is responsible for keeping the allocation
+	 *	alive until aCommandBuffer has completed, e.g. by moving it into its custom deleter.
+	 */
+	static void record_staged_upload_to_image(const staging_ring::allocation& aStaging, avk::image_t& aImage, uint32_t aMipLevel, avk::command_buffer_t& aCommandBuffer)
+	{
+		const auto extent = aImage.config().extent;
+		const auto region = vk::BufferImageCopy{}
+			.setBufferOffset(aStaging.offset())
+			.setBufferRowLength(0u) // tightly packed
+			.setBufferImageHeight(0u)
+			.setImageSubresource(vk::ImageSubresourceLayers{ vk::ImageAspectFlagBits::eColor, aMipLevel, 0u, 1u })
+			.setImageOffset({ 0, 0, 0 })
+			.setImageExtent({ std::max(extent.width >> aMipLevel, 1u), std::max(extent.height >> aMipLevel, 1u), std::max(extent.depth >> aMipLevel, 1u) });
+		aCommandBuffer.handle().copyBufferToImage(aStaging.buffer()->handle(), aImage.handle(), vk::ImageLayout::eTransferDstOptimal, 1u, &region);
+	}
+
 	static avk::image create_1px_texture_cached(std::array<uint8_t, 4> aColor, vk::Format aFormat = vk::Format::eR8G8B8A8Unorm, avk::memory_usage aMemoryUsage = avk::memory_usage::device, avk::image_usage aImageUsage = avk::image_usage::general_texture, avk::sync aSyncHandler = avk::sync::wait_idle(), std::optional<std::reference_wrapper<gvk::serializer>> aSerializer = {})
 	{
 		auto& commandBuffer = aSyncHandler.get_or_create_command_buffer();
 		aSyncHandler.establish_barrier_before_the_operation(avk::pipeline_stage::transfer, avk::read_memory_access{avk::memory_access::transfer_read_access});
 
-		auto stagingBuffer = context().create_buffer(
-			AVK_STAGING_BUFFER_MEMORY_USAGE,
-			vk::BufferUsageFlagBits::eTransferSrc,
-			avk::generic_buffer_meta::create_from_size(sizeof(aColor))
-		);
+		auto stagingBuffer = context().upload_staging_ring().allocate(sizeof(aColor), staging_ring::sImageCopyAlignment);
 		if (!aSerializer) {
-			stagingBuffer->fill(aColor.data(), 0, avk::sync::not_required());
+			stagingBuffer.fill(aColor.data(), sizeof(aColor));
 		}
 		else if (aSerializer && aSerializer->get().mode() == gvk::serializer::mode::serialize) {
-			stagingBuffer->fill(aColor.data(), 0, avk::sync::not_required());
+			stagingBuffer.fill(aColor.data(), sizeof(aColor));
 			aSerializer->get().archive_memory(aColor.data(), sizeof(aColor));
 		}
 		else if (aSerializer && aSerializer->get().mode() == gvk::serializer::mode::deserialize) {
-			aSerializer->get().archive_buffer(stagingBuffer);
+			stagingBuffer.write([&](void* aTarget) { aSerializer->get().archive_memory(aTarget, sizeof(aColor)); });
 		}
 
 		auto img = context().create_image(1u, 1u, aFormat, 1, aMemoryUsage, aImageUsage);
@@ -31,7 +44,7 @@ namespace gvk
 		img->transition_to_layout(vk::ImageLayout::eTransferDstOptimal, avk::sync::auxiliary_with_barriers(aSyncHandler, {}, {})); // no need for additional sync
 
 		// 2. Copy buffer to image
-		copy_buffer_to_image(avk::const_referenced(stagingBuffer), avk::referenced(img), {}, avk::sync::auxiliary_with_barriers(aSyncHandler, {}, {})); // There should be no need to make any memory available or visible, the transfer-execution dependency chain should be fine
+		record_staged_upload_to_image(stagingBuffer, img.get(), 0u, commandBuffer); // There should be no need to make any memory available or visible, the transfer-execution dependency chain should be fine
 																									   // TODO: Verify the above ^ comment
 		commandBuffer.set_custom_deleter([lOwnedStagingBuffer=std::move(stagingBuffer)](){});
 
@@ -71,12 +84,249 @@ namespace gvk
 		return create_1px_texture_cached(aColor, aFormat, aMemoryUsage, aImageUsage, std::move(aSyncHandler), aSerializer);
 	}
 
+	/**	Loads the pixel data of an image file into CPU memory, without performing any GPU operations.
+	 *	This function is thread-safe, i.e. multiple image files can be loaded in parallel.
+	 *	The result can be passed to create_image_from_file_cached as aAlreadyLoadedGliTexture.
+	 *	@param	aPath		Path to the image file
+	 *	@param	aFormat		The format that the image is going to be created with. Block-compressed formats
+	 *						are loaded via gli, 8-bit and 16-bit float formats are loaded via stb_image with
+	 *						the number of channels of aFormat.
+	 *	@param	aFlip		Flip the image vertically. Only applies to formats that are loaded via stb_image.
+	 */
+	static gli::texture load_image_file_data(const std::string& aPath, vk::Format aFormat, bool aFlip = true)
+	{
+		// ============ Compressed formats (DDS) ==========
+		if (avk::is_block_compressed_format(aFormat)) {
+			return gli::load(aPath);
+		}
+
+		int desiredColorChannels = STBI_rgb_alpha;
+		if (!avk::is_4component_format(aFormat)) {
+			if (avk::is_3component_format(aFormat)) {
+				desiredColorChannels = STBI_rgb;
+			}
+			else if (avk::is_2component_format(aFormat)) {
+				desiredColorChannels = STBI_grey_alpha;
+			}
+			else if (avk::is_1component_format(aFormat)) {
+				desiredColorChannels = STBI_grey;
+			}
+		}
+
+		int width = 0;
+		int height = 0;
+		int channelsInFile = 0;
+
+		// ============ RGB 8-bit formats ==========
+		if (avk::is_uint8_format(aFormat) || avk::is_int8_format(aFormat)) {
+			// The thread-local flip setting does not interfere with loads on other threads:
+			stbi_set_flip_vertically_on_load_thread(aFlip);
+			stbi_uc* pixels = stbi_load(aPath.c_str(), &width, &height, &channelsInFile, desiredColorChannels);
+			if (!pixels) {
+				throw gvk::runtime_error(fmt::format("Couldn't load image from '{}' using stbi_load", aPath));
+			}
+
+			static constexpr std::array<gli::format, 4> sGliFormats = { gli::FORMAT_R8_UNORM_PACK8, gli::FORMAT_RG8_UNORM_PACK8, gli::FORMAT_RGB8_UNORM_PACK8, gli::FORMAT_RGBA8_UNORM_PACK8 };
+			gli::texture2d gliTex(sGliFormats[desiredColorChannels - 1], gli::extent2d(width, height), 1);
+			std::memcpy(gliTex.data(), pixels, gliTex.size());
+			stbi_image_free(pixels);
+			return gliTex;
+		}
+
+		// ============ RGB 16-bit float formats (HDR) ==========
+		if (avk::is_float16_format(aFormat)) {
+			stbi_set_flip_vertically_on_load_thread(true);
+			float* pixels = stbi_loadf(aPath.c_str(), &width, &height, &channelsInFile, desiredColorChannels);
+			if (!pixels) {
+				throw gvk::runtime_error(fmt::format("Couldn't load image from '{}' using stbi_loadf", aPath));
+			}
+
+			static constexpr std::array<gli::format, 4> sGliFormats = { gli::FORMAT_R32_SFLOAT_PACK32, gli::FORMAT_RG32_SFLOAT_PACK32, gli::FORMAT_RGB32_SFLOAT_PACK32, gli::FORMAT_RGBA32_SFLOAT_PACK32 };
+			gli::texture2d gliTex(sGliFormats[desiredColorChannels - 1], gli::extent2d(width, height), 1);
+			std::memcpy(gliTex.data(), pixels, gliTex.size());
+			stbi_image_free(pixels);
+			return gliTex;
+		}
+
+		throw gvk::runtime_error("No loader for the given image format implemented.");
+	}
+
+	/** An image file which has been loaded into CPU memory, but not uploaded to the GPU yet. */
+	struct loaded_image_file
+	{
+		vk::Format mFormat;
+		gli::texture mData;
+	};
+
+	/**	Generates the full MIP chain of an uncompressed 8-bit image on the CPU and block-compresses all
+	 *	MIP levels. The block-compressed format is selected based on the number of components:
+	 *	 - 1 component:  BC4
+	 *	 - 2 components: BC5
+	 *	 - 3 components: BC1
+	 *	 - 4 components: BC3, or BC1 if all texels are fully opaque
+	 *	This function is thread-safe.
+	 *	@param	aImage		Uncompressed 8-bit image data, as returned by load_image_file_data. Only the first MIP level is used.
+	 *	@param	aSrgb		If true, MIP levels are filtered in linear space, and BC1 and BC3 are created in their sRGB variants.
+	 *	@return	The block-compressed image data with all MIP levels, and its format
+	 */
+	extern loaded_image_file generate_mip_maps_and_compress(const gli::texture& aImage, bool aSrgb);
+
+	/**	Determines the format of an image file and loads its pixel data into CPU memory, without
+	 *	performing any GPU operations. This function is thread-safe, i.e. multiple image files can be
+	 *	loaded in parallel. The result can be passed to create_image_from_file_cached as aAlreadyLoadedImage.
+	 *	See create_image_from_file_cached for the meaning of the parameters.
+	 *	@param	aCompress	If true, 8-bit images which are not block-compressed already, are passed through
+	 *						generate_mip_maps_and_compress, i.e. the result contains all MIP levels in a
+	 *						block-compressed format.
+	 */
+	static loaded_image_file load_image_file(const std::string& aPath, bool aLoadHdrIfPossible = true, bool aLoadSrgbIfApplicable = true, bool aFlip = true, int aPreferredNumberOfTextureComponents = 4, bool aCompress = false)
+	{
+		std::optional<vk::Format> imFmt = {};
+
+		std::optional<gli::texture> gliTex = gli::load(aPath);
+		if (!gliTex.value().empty()) {
+
+			if (aFlip && (!gli::is_compressed(gliTex.value().format()) || gli::is_s3tc_compressed(gliTex.value().format()))) {
+				gliTex = gli::flip(gliTex.value());
+			}
+
+			auto gliFmt = gliTex.value().format();
+			switch (gliFmt) {
+				// See "Khronos Data Format Specification": https://www.khronos.org/registry/DataFormat/specs/1.3/dataformat.1.3.html#S3TC
+				// And Vulkan specification: https://www.khronos.org/registry/vulkan/specs/1.2-khr-extensions/html/chap42.html#appendix-compressedtex-bc
+			case gli::format::FORMAT_RGB_DXT1_UNORM_BLOCK8:
+				imFmt = vk::Format::eBc1RgbUnormBlock;
+				break;
+			case gli::format::FORMAT_RGB_DXT1_SRGB_BLOCK8:
+				imFmt = vk::Format::eBc1RgbSrgbBlock;
+				break;
+			case gli::format::FORMAT_RGBA_DXT1_UNORM_BLOCK8:
+				imFmt = vk::Format::eBc1RgbaUnormBlock;
+				break;
+			case gli::format::FORMAT_RGBA_DXT1_SRGB_BLOCK8:
+				imFmt = vk::Format::eBc1RgbaSrgbBlock;
+				break;
+			case gli::format::FORMAT_RGBA_DXT3_UNORM_BLOCK16:
+				imFmt = vk::Format::eBc2UnormBlock;
+				break;
+			case gli::format::FORMAT_RGBA_DXT3_SRGB_BLOCK16:
+				imFmt = vk::Format::eBc2SrgbBlock;
+				break;
+			case gli::format::FORMAT_RGBA_DXT5_UNORM_BLOCK16:
+				imFmt = vk::Format::eBc3UnormBlock;
+				break;
+			case gli::format::FORMAT_RGBA_DXT5_SRGB_BLOCK16:
+				imFmt = vk::Format::eBc3SrgbBlock;
+				break;
+			case gli::format::FORMAT_R_ATI1N_UNORM_BLOCK8:
+				imFmt = vk::Format::eBc4UnormBlock;
+				break;
+				// See "Khronos Data Format Specification": https://www.khronos.org/registry/DataFormat/specs/1.3/dataformat.1.3.html#RGTC
+				// And Vulkan specification: https://www.khronos.org/registry/vulkan/specs/1.2-khr-extensions/html/chap42.html#appendix-compressedtex-bc
+			case gli::format::FORMAT_R_ATI1N_SNORM_BLOCK8:
+				imFmt = vk::Format::eBc4SnormBlock;
+				break;
+			case gli::format::FORMAT_RG_ATI2N_UNORM_BLOCK16:
+				imFmt = vk::Format::eBc5UnormBlock;
+				break;
+			case gli::format::FORMAT_RG_ATI2N_SNORM_BLOCK16:
+				imFmt = vk::Format::eBc5SnormBlock;
+			}
+		}
+		else {
+			gliTex.reset();
+		}
+
+		if (!imFmt.has_value() && aLoadHdrIfPossible) {
+			if (stbi_is_hdr(aPath.c_str())) {
+				switch (aPreferredNumberOfTextureComponents) {
+				case 4:
+					imFmt = default_rgb16f_4comp_format();
+					break;
+					// Attention: There's a high likelihood that your GPU does not support formats with less than four color components!
+				case 3:
+					imFmt = default_rgb16f_3comp_format();
+					break;
+				case 2:
+					imFmt = default_rgb16f_2comp_format();
+					break;
+				case 1:
+					imFmt = default_rgb16f_1comp_format();
+					break;
+				default:
+					imFmt = default_rgb16f_4comp_format();
+					break;
+				}
+			}
+		}
+
+		if (!imFmt.has_value() && aLoadSrgbIfApplicable) {
+			switch (aPreferredNumberOfTextureComponents) {
+			case 4:
+				imFmt = gvk::default_srgb_4comp_format();
+				break;
+				// Attention: There's a high likelihood that your GPU does not support formats with less than four color components!
+			case 3:
+				imFmt = gvk::default_srgb_3comp_format();
+				break;
+			case 2:
+				imFmt = gvk::default_srgb_2comp_format();
+				break;
+			case 1:
+				imFmt = gvk::default_srgb_1comp_format();
+				break;
+			default:
+				imFmt = gvk::default_srgb_4comp_format();
+				break;
+			}
+		}
+
+		if (!imFmt.has_value()) {
+			switch (aPreferredNumberOfTextureComponents) {
+			case 4:
+				imFmt = gvk::default_rgb8_4comp_format();
+				break;
+				// Attention: There's a high likelihood that your GPU does not support formats with less than four color components!
+			case 3:
+				imFmt = gvk::default_rgb8_3comp_format();
+				break;
+			case 2:
+				imFmt = gvk::default_rgb8_2comp_format();
+				break;
+			case 1:
+				imFmt = gvk::default_rgb8_1comp_format();
+				break;
+			default:
+				imFmt = gvk::default_rgb8_4comp_format();
+				break;
+			}
+		}
+
+		if (!imFmt.has_value()) {
+			throw gvk::runtime_error(fmt::format("Could not determine the image format of image '{}'", aPath));
+		}
+
+		// gli's data is only used for block-compressed formats, all other formats are loaded via stb_image:
+		if (!avk::is_block_compressed_format(imFmt.value())) {
+			gliTex = load_image_file_data(aPath, imFmt.value(), aFlip);
+			if (aCompress && avk::is_uint8_format(imFmt.value())) {
+				return generate_mip_maps_and_compress(gliTex.value(), avk::is_srgb_format(imFmt.value()));
+			}
+		}
+		return loaded_image_file{ imFmt.value(), std::move(gliTex.value()) };
+	}
+
 	static avk::image create_image_from_file_cached(const std::string& aPath, vk::Format aFormat, bool aFlip = true, avk::memory_usage aMemoryUsage = avk::memory_usage::device, avk::image_usage aImageUsage = avk::image_usage::general_texture, avk::sync aSyncHandler = avk::sync::wait_idle(), std::optional<gli::texture> aAlreadyLoadedGliTexture = {}, std::optional<std::reference_wrapper<gvk::serializer>> aSerializer = {})
 	{
-		std::vector<avk::buffer> stagingBuffers;
+		std::vector<staging_ring::allocation> stagingBuffers;
 		int width = 0;
 		int height = 0;
 
+		if (aSerializer) {
+			// Record the image file, s.t. the cache file gets rebuilt whenever the image changes:
+			aSerializer->get().add_source_file(aPath);
+		}
+
 		// ============ Compressed formats (DDS) ==========
 		if (avk::is_block_compressed_format(aFormat)) {
 			size_t texSize = 0;
@@ -105,104 +355,34 @@ namespace gvk
 				aSerializer->get().archive(height);
 			}
 
-			auto& sb = stagingBuffers.emplace_back(context().create_buffer(
-				AVK_STAGING_BUFFER_MEMORY_USAGE,
-				vk::BufferUsageFlagBits::eTransferSrc,
-				avk::generic_buffer_meta::create_from_size(texSize)
-			));
+			auto& sb = stagingBuffers.emplace_back(context().upload_staging_ring().allocate(texSize, staging_ring::sImageCopyAlignment));
 
 			if (!aSerializer) {
-				sb->fill(texData, 0, avk::sync::not_required());
+				sb.fill(texData, texSize);
 			}
 			else if (aSerializer && aSerializer->get().mode() == gvk::serializer::mode::serialize) {
-				sb->fill(texData, 0, avk::sync::not_required());
+				sb.fill(texData, texSize);
 				aSerializer->get().archive_memory(texData, texSize);
 			}
 			else if (aSerializer && aSerializer->get().mode() == gvk::serializer::mode::deserialize) {
-				aSerializer->get().archive_buffer(sb);
-			}
-		}
-		// ============ RGB 8-bit formats ==========
-		else if (avk::is_uint8_format(aFormat) || avk::is_int8_format(aFormat)) {
-			size_t imageSize = 0;
-			stbi_uc* pixels = nullptr;
-			if (!aSerializer ||
-				(aSerializer && aSerializer->get().mode() == gvk::serializer::mode::serialize)) {
-				stbi_set_flip_vertically_on_load(aFlip);
-				int desiredColorChannels = STBI_rgb_alpha;
-
-				if (!avk::is_4component_format(aFormat)) {
-					if (avk::is_3component_format(aFormat)) {
-						desiredColorChannels = STBI_rgb;
-					}
-					else if (avk::is_2component_format(aFormat)) {
-						desiredColorChannels = STBI_grey_alpha;
-					}
-					else if (avk::is_1component_format(aFormat)) {
-						desiredColorChannels = STBI_grey;
-					}
-				}
-
-				int channelsInFile = 0;
-				pixels = stbi_load(aPath.c_str(), &width, &height, &channelsInFile, desiredColorChannels);
-				imageSize = static_cast<size_t>(width) * static_cast<size_t>(height) * static_cast<size_t>(desiredColorChannels);
-
-				if (!pixels) {
-					throw gvk::runtime_error(fmt::format("Couldn't load image from '{}' using stbi_load", aPath));
-				}
-			}
-
-			if (aSerializer) {
-				aSerializer->get().archive(imageSize);
-				aSerializer->get().archive(width);
-				aSerializer->get().archive(height);
-			}
-
-			auto& sb = stagingBuffers.emplace_back(context().create_buffer(
-				AVK_STAGING_BUFFER_MEMORY_USAGE,
-				vk::BufferUsageFlagBits::eTransferSrc,
-				avk::generic_buffer_meta::create_from_size(imageSize)
-			));
-
-			if (!aSerializer) {
-				sb->fill(pixels, 0, avk::sync::not_required());
-			}
-			else if (aSerializer && aSerializer->get().mode() == gvk::serializer::mode::serialize) {
-				sb->fill(pixels, 0, avk::sync::not_required());
-				aSerializer->get().archive_memory(pixels, imageSize);
-			}
-			else if (aSerializer && aSerializer->get().mode() == gvk::serializer::mode::deserialize) {
-				aSerializer->get().archive_buffer(sb);
+				sb.write([&](void* aTarget) { aSerializer->get().archive_memory(aTarget, texSize); });
 			}
 		}
-		// ============ RGB 16-bit float formats (HDR) ==========
-		else if (avk::is_float16_format(aFormat)) {
+		// ============ RGB 8-bit formats and RGB 16-bit float formats (HDR) ==========
+		else if (avk::is_uint8_format(aFormat) || avk::is_int8_format(aFormat) || avk::is_float16_format(aFormat)) {
 			size_t imageSize = 0;
-			float* pixels = nullptr;
+			void* pixels = nullptr;
 			if (!aSerializer ||
 				(aSerializer && aSerializer->get().mode() == gvk::serializer::mode::serialize)) {
-				stbi_set_flip_vertically_on_load(true);
-				int desiredColorChannels = STBI_rgb_alpha;
-
-				if (!avk::is_4component_format(aFormat)) {
-					if (avk::is_3component_format(aFormat)) {
-						desiredColorChannels = STBI_rgb;
-					}
-					else if (avk::is_2component_format(aFormat)) {
-						desiredColorChannels = STBI_grey_alpha;
-					}
-					else if (avk::is_1component_format(aFormat)) {
-						desiredColorChannels = STBI_grey;
-					}
+				if (!aAlreadyLoadedGliTexture.has_value()) {
+					aAlreadyLoadedGliTexture = load_image_file_data(aPath, aFormat, aFlip);
 				}
+				auto& gliTex = aAlreadyLoadedGliTexture.value();
 
-				int channelsInFile = 0;
-				pixels = stbi_loadf(aPath.c_str(), &width, &height, &channelsInFile, desiredColorChannels);
-				imageSize = static_cast<size_t>(width) * static_cast<size_t>(height) * static_cast<size_t>(desiredColorChannels);
-
-				if (!pixels) {
-					throw gvk::runtime_error(fmt::format("Couldn't load image from '{}' using stbi_loadf", aPath));
-				}
+				pixels = gliTex.data();
+				width = gliTex.extent()[0];
+				height = gliTex.extent()[1];
+				imageSize = static_cast<size_t>(width) * static_cast<size_t>(height) * static_cast<size_t>(gli::component_count(gliTex.format()));
 			}
 
 			if (aSerializer) {
@@ -211,21 +391,17 @@ namespace gvk
 				aSerializer->get().archive(height);
 			}
 
-			auto& sb = stagingBuffers.emplace_back(context().create_buffer(
-				AVK_STAGING_BUFFER_MEMORY_USAGE,
-				vk::BufferUsageFlagBits::eTransferSrc,
-				avk::generic_buffer_meta::create_from_size(imageSize)
-			));
+			auto& sb = stagingBuffers.emplace_back(context().upload_staging_ring().allocate(imageSize, staging_ring::sImageCopyAlignment));
 
 			if (!aSerializer) {
-				sb->fill(pixels, 0, avk::sync::not_required());
+				sb.fill(pixels, imageSize);
 			}
 			else if (aSerializer && aSerializer->get().mode() == gvk::serializer::mode::serialize) {
-				sb->fill(pixels, 0, avk::sync::not_required());
+				sb.fill(pixels, imageSize);
 				aSerializer->get().archive_memory(pixels, imageSize);
 			}
 			else if (aSerializer && aSerializer->get().mode() == gvk::serializer::mode::deserialize) {
-				aSerializer->get().archive_buffer(sb);
+				sb.write([&](void* aTarget) { aSerializer->get().archive_memory(aTarget, imageSize); });
 			}
 		}
 		else {
@@ -244,7 +420,7 @@ namespace gvk
 
 		// 2. Copy buffer to image
 		assert(stagingBuffers.size() == 1);
-		avk::copy_buffer_to_image(avk::const_referenced(stagingBuffers.front()), avk::referenced(img), {}, avk::sync::auxiliary_with_barriers(aSyncHandler, {}, {}));  // There should be no need to make any memory available or visible, the transfer-execution dependency chain should be fine
+		record_staged_upload_to_image(stagingBuffers.front(), img.get(), 0u, commandBuffer);  // There should be no need to make any memory available or visible, the transfer-execution dependency chain should be fine
 																																						// TODO: Verify the above ^ comment
 		// Are MIP-maps required?
 		if (img->config().mipLevels > 1u) {
@@ -293,25 +469,21 @@ namespace gvk
 					}
 #endif
 
-					auto& sb = stagingBuffers.emplace_back(context().create_buffer(
-						AVK_STAGING_BUFFER_MEMORY_USAGE,
-						vk::BufferUsageFlagBits::eTransferSrc,
-						avk::generic_buffer_meta::create_from_size(texSize)
-					));
+					auto& sb = stagingBuffers.emplace_back(context().upload_staging_ring().allocate(texSize, staging_ring::sImageCopyAlignment));
 
 					if (!aSerializer) {
-						sb->fill(texData, 0, avk::sync::not_required());
+						sb.fill(texData, texSize);
 					}
 					else if (aSerializer && aSerializer->get().mode() == gvk::serializer::mode::serialize) {
-						sb->fill(texData, 0, avk::sync::not_required());
+						sb.fill(texData, texSize);
 						aSerializer->get().archive_memory(texData, texSize);
 					}
 					else if (aSerializer && aSerializer->get().mode() == gvk::serializer::mode::deserialize) {
-						aSerializer->get().archive_buffer(sb);
+						sb.write([&](void* aTarget) { aSerializer->get().archive_memory(aTarget, texSize); });
 					}
 
 					// Memory writes are not overlapping => no barriers should be fine.
-					avk::copy_buffer_to_image_mip_level(avk::const_referenced(sb), avk::referenced(img), level, {}, avk::sync::auxiliary_with_barriers(aSyncHandler, {}, {}));
+					record_staged_upload_to_image(sb, img.get(), static_cast<uint32_t>(level), commandBuffer);
 				}
 			}
 			else {
@@ -341,132 +513,18 @@ namespace gvk
 		return create_image_from_file_cached(aPath, aFormat, aFlip, aMemoryUsage, aImageUsage, std::move(aSyncHandler), std::move(aAlreadyLoadedGliTexture));
 	}
 
-	static avk::image create_image_from_file_cached(const std::string& aPath, bool aLoadHdrIfPossible = true, bool aLoadSrgbIfApplicable = true, bool aFlip = true, int aPreferredNumberOfTextureComponents = 4, avk::memory_usage aMemoryUsage = avk::memory_usage::device, avk::image_usage aImageUsage = avk::image_usage::general_texture, avk::sync aSyncHandler = avk::sync::wait_idle(), std::optional<std::reference_wrapper<gvk::serializer>> aSerializer = {})
+	static avk::image create_image_from_file_cached(const std::string& aPath, bool aLoadHdrIfPossible = true, bool aLoadSrgbIfApplicable = true, bool aFlip = true, int aPreferredNumberOfTextureComponents = 4, avk::memory_usage aMemoryUsage = avk::memory_usage::device, avk::image_usage aImageUsage = avk::image_usage::general_texture, avk::sync aSyncHandler = avk::sync::wait_idle(), std::optional<std::reference_wrapper<gvk::serializer>> aSerializer = {}, std::optional<loaded_image_file> aAlreadyLoadedImage = {})
 	{
 		std::optional<vk::Format> imFmt = {};
 
 		std::optional<gli::texture> gliTex = {};
 		if (!aSerializer ||
 			(aSerializer && aSerializer->get().mode() == gvk::serializer::mode::serialize)) {
-			gliTex = gli::load(aPath);
-			if (!gliTex.value().empty()) {
-
-				if (aFlip && (!gli::is_compressed(gliTex.value().format()) || gli::is_s3tc_compressed(gliTex.value().format()))) {
-					gliTex = gli::flip(gliTex.value());
-				}
-
-				auto gliFmt = gliTex.value().format();
-				switch (gliFmt) {
-					// See "Khronos Data Format Specification": https://www.khronos.org/registry/DataFormat/specs/1.3/dataformat.1.3.html#S3TC
-					// And Vulkan specification: https://www.khronos.org/registry/vulkan/specs/1.2-khr-extensions/html/chap42.html#appendix-compressedtex-bc
-				case gli::format::FORMAT_RGB_DXT1_UNORM_BLOCK8:
-					imFmt = vk::Format::eBc1RgbUnormBlock;
-					break;
-				case gli::format::FORMAT_RGB_DXT1_SRGB_BLOCK8:
-					imFmt = vk::Format::eBc1RgbSrgbBlock;
-					break;
-				case gli::format::FORMAT_RGBA_DXT1_UNORM_BLOCK8:
-					imFmt = vk::Format::eBc1RgbaUnormBlock;
-					break;
-				case gli::format::FORMAT_RGBA_DXT1_SRGB_BLOCK8:
-					imFmt = vk::Format::eBc1RgbaSrgbBlock;
-					break;
-				case gli::format::FORMAT_RGBA_DXT3_UNORM_BLOCK16:
-					imFmt = vk::Format::eBc2UnormBlock;
-					break;
-				case gli::format::FORMAT_RGBA_DXT3_SRGB_BLOCK16:
-					imFmt = vk::Format::eBc2SrgbBlock;
-					break;
-				case gli::format::FORMAT_RGBA_DXT5_UNORM_BLOCK16:
-					imFmt = vk::Format::eBc3UnormBlock;
-					break;
-				case gli::format::FORMAT_RGBA_DXT5_SRGB_BLOCK16:
-					imFmt = vk::Format::eBc3SrgbBlock;
-					break;
-				case gli::format::FORMAT_R_ATI1N_UNORM_BLOCK8:
-					imFmt = vk::Format::eBc4UnormBlock;
-					break;
-					// See "Khronos Data Format Specification": https://www.khronos.org/registry/DataFormat/specs/1.3/dataformat.1.3.html#RGTC
-					// And Vulkan specification: https://www.khronos.org/registry/vulkan/specs/1.2-khr-extensions/html/chap42.html#appendix-compressedtex-bc
-				case gli::format::FORMAT_R_ATI1N_SNORM_BLOCK8:
-					imFmt = vk::Format::eBc4SnormBlock;
-					break;
-				case gli::format::FORMAT_RG_ATI2N_UNORM_BLOCK16:
-					imFmt = vk::Format::eBc5UnormBlock;
-					break;
-				case gli::format::FORMAT_RG_ATI2N_SNORM_BLOCK16:
-					imFmt = vk::Format::eBc5SnormBlock;
-				}
-			}
-			else {
-				gliTex.reset();
-			}
-
-			if (!imFmt.has_value() && aLoadHdrIfPossible) {
-				if (stbi_is_hdr(aPath.c_str())) {
-					switch (aPreferredNumberOfTextureComponents) {
-					case 4:
-						imFmt = default_rgb16f_4comp_format();
-						break;
-						// Attention: There's a high likelihood that your GPU does not support formats with less than four color components!
-					case 3:
-						imFmt = default_rgb16f_3comp_format();
-						break;
-					case 2:
-						imFmt = default_rgb16f_2comp_format();
-						break;
-					case 1:
-						imFmt = default_rgb16f_1comp_format();
-						break;
-					default:
-						imFmt = default_rgb16f_4comp_format();
-						break;
-					}
-				}
-			}
-
-			if (!imFmt.has_value() && aLoadSrgbIfApplicable) {
-				switch (aPreferredNumberOfTextureComponents) {
-				case 4:
-					imFmt = gvk::default_srgb_4comp_format();
-					break;
-					// Attention: There's a high likelihood that your GPU does not support formats with less than four color components!
-				case 3:
-					imFmt = gvk::default_srgb_3comp_format();
-					break;
-				case 2:
-					imFmt = gvk::default_srgb_2comp_format();
-					break;
-				case 1:
-					imFmt = gvk::default_srgb_1comp_format();
-					break;
-				default:
-					imFmt = gvk::default_srgb_4comp_format();
-					break;
-				}
+			if (!aAlreadyLoadedImage.has_value()) {
+				aAlreadyLoadedImage = load_image_file(aPath, aLoadHdrIfPossible, aLoadSrgbIfApplicable, aFlip, aPreferredNumberOfTextureComponents);
 			}
-
-			if (!imFmt.has_value()) {
-				switch (aPreferredNumberOfTextureComponents) {
-				case 4:
-					imFmt = gvk::default_rgb8_4comp_format();
-					break;
-					// Attention: There's a high likelihood that your GPU does not support formats with less than four color components!
-				case 3:
-					imFmt = gvk::default_rgb8_3comp_format();
-					break;
-				case 2:
-					imFmt = gvk::default_rgb8_2comp_format();
-					break;
-				case 1:
-					imFmt = gvk::default_rgb8_1comp_format();
-					break;
-				default:
-					imFmt = gvk::default_rgb8_4comp_format();
-					break;
-				}
-			}
-
+			imFmt = aAlreadyLoadedImage->mFormat;
+			gliTex = std::move(aAlreadyLoadedImage->mData);
 		}
 
 		if (aSerializer) {
@@ -525,6 +583,13 @@ namespace gvk
 	 *	@param	aTextureFilterMode		Texture filter mode for all the textures that are loaded.
 	 *	@param	aBorderHandlingMode		Border handling mode for all the textures that are loaded.
 	 *	@param	aSyncHandler			How to synchronize the GPU-upload of texture memory.
+	 *	@param	aCompressTextures		If true, MIP levels are generated on the CPU and all textures which are not
+	 *									block-compressed already, are block-compressed before being uploaded.
+	 *									See generate_mip_maps_and_compress for details. When a serializer is used,
+	 *									the compressed data and this setting are stored in the cache file. Pass the
+	 *									same value to the serializer's constructor, s.t. the cache file is rebuilt
+	 *									when the setting changes; reading a cache file which has been written with
+	 *									the other setting throws a gvk::runtime_error.
 	 *	@return	A tuple of two elements: The first element contains a vector of gvk::material_gpu_data
 	 *			entries, which are gvk::material_config entries converted into a format suitable to be
 	 *			used in UBOs or SSBOs, and the second element contains a vector of avk::image_samplers,
@@ -539,7 +604,8 @@ namespace gvk
 		avk::image_usage aImageUsage = avk::image_usage::general_texture,
 		avk::filter_mode aTextureFilterMode = avk::filter_mode::trilinear,
 		avk::border_handling_mode aBorderHandlingMode = avk::border_handling_mode::repeat,
-		avk::sync aSyncHandler = avk::sync::wait_idle());
+		avk::sync aSyncHandler = avk::sync::wait_idle(),
+		bool aCompressTextures = false);
 
 	template <typename... Rest>
 	void add_tuple_or_indices(std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aResult)
@@ -601,6 +667,101 @@ namespace gvk
 	extern std::vector<glm::vec3> get_3d_texture_coordinates(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet);
 	extern avk::buffer create_3d_texture_coordinates_buffer(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet = 0, avk::sync aSyncHandler = avk::sync::wait_idle());
 
+	/**	Returns the model-space bounds (see model_t::transformed_bounds_for_mesh) of all the selected meshes,
+	 *	in the order of the selection, i.e. one entry per selected mesh.
+	 */
+	extern std::vector<mesh_bounds> get_mesh_bounds(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes);
+
+	/** Draw parameters of one mesh within a scene geometry, where all meshes share the same vertex and index buffers.
+	 *	The members correspond to the parameters of vkCmdDrawIndexed and vk::DrawIndexedIndirectCommand, respectively.
+	 */
+	struct scene_geometry_draw
+	{
+		/** Index of the model within the models-and-meshes selection which the scene geometry has been created from */
+		uint32_t mModelIndex;
+		/** Index of the mesh within its model */
+		mesh_index_t mMeshIndex;
+		/** Number of indices of the mesh */
+		uint32_t mIndexCount;
+		/** Offset of the mesh's first index within the index buffer */
+		uint32_t mFirstIndex;
+		/** Offset of the mesh's first vertex within the vertex buffers; it is added to each of the mesh's indices */
+		int32_t mVertexOffset;
+		/** Number of vertices of the mesh */
+		uint32_t mVertexCount;
+	};
+
+	/** CPU-side data of a scene geometry, i.e. the vertex data of all selected meshes of all selected models,
+	 *	packed into one array per attribute, and one array containing the indices of all meshes.
+	 *	The indices of each mesh are NOT offset by the mesh's position within the vertex arrays. Use
+	 *	scene_geometry_draw::mVertexOffset as vertexOffset parameter of the draw call instead.
+	 */
+	struct scene_geometry_data
+	{
+		std::vector<glm::vec3> mPositions;
+		std::vector<glm::vec2> mTexCoords;
+		std::vector<glm::vec3> mNormals;
+		std::vector<uint32_t> mIndices;
+		/** One entry per mesh, in the order of the models-and-meshes selection */
+		std::vector<scene_geometry_draw> mDraws;
+	};
+
+	/** GPU-side scene geometry, i.e. one vertex buffer per attribute and one index buffer for all selected meshes
+	 *	of all selected models, and an indirect draw buffer which contains one vk::DrawIndexedIndirectCommand per mesh.
+	 *	Each command's firstInstance is set to the index of its draw, s.t. per-draw data (like material indices or
+	 *	transformation matrices) can be looked up in shaders via gl_InstanceIndex (for an instance count of 1).
+	 *
+	 *	All meshes can be drawn with one single indirect draw call, after having bound the buffers once:
+	 *
+	 *		cmd.handle().bindVertexBuffers(0u, { geo.mPositionsBuffer->handle(), geo.mTexCoordsBuffer->handle(), geo.mNormalsBuffer->handle() }, { 0, 0, 0 });
+	 *		cmd.handle().bindIndexBuffer(geo.mIndexBuffer->handle(), 0u, vk::IndexType::eUint32);
+	 *		cmd.handle().drawIndexedIndirect(geo.mDrawCommandsBuffer->handle(), 0u, geo.number_of_draws(), sizeof(vk::DrawIndexedIndirectCommand));
+	 *
+	 *	A drawCount greater than 1 requires the multiDrawIndirect device feature, and non-zero firstInstance values
+	 *	require the drawIndirectFirstInstance device feature. Request both via gvk::alter_requested_physical_device_features:
+	 *
+	 *		gvk::alter_requested_physical_device_features([](vk::PhysicalDeviceFeatures& aFeatures) {
+	 *			aFeatures.setMultiDrawIndirect(VK_TRUE);
+	 *			aFeatures.setDrawIndirectFirstInstance(VK_TRUE);
+	 *		})
+	 *
+	 *	Without multiDrawIndirect, issue one drawIndexedIndirect per draw, with a drawCount of 1 and an offset of
+	 *	i * sizeof(vk::DrawIndexedIndirectCommand).
+	 */
+	struct scene_geometry
+	{
+		avk::buffer mPositionsBuffer;
+		avk::buffer mTexCoordsBuffer;
+		avk::buffer mNormalsBuffer;
+		avk::buffer mIndexBuffer;
+		/** Contains number_of_draws() tightly packed vk::DrawIndexedIndirectCommand entries */
+		avk::buffer mDrawCommandsBuffer;
+		std::vector<scene_geometry_draw> mDraws;
+
+		uint32_t number_of_draws() const { return static_cast<uint32_t>(mDraws.size()); }
+	};
+
+	/**	Gathers the positions, 2D texture coordinates, normals, and indices of all the selected meshes into one scene geometry.
+	 *	@param	aModelsAndSelectedMeshes	The selection of models and meshes, see make_models_and_meshes_selection
+	 *	@param	aTexCoordSet				The texture coordinate set to gather
+	 *	@param	aFlipTexCoords				If true, the v-coordinates are flipped, i.e. written as 1 - v
+	 */
+	extern scene_geometry_data get_scene_geometry(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet = 0, bool aFlipTexCoords = false);
+	/** Returns one vk::DrawIndexedIndirectCommand per draw, with firstInstance set to the draw's index */
+	extern std::vector<vk::DrawIndexedIndirectCommand> get_draw_indexed_indirect_commands(const std::vector<scene_geometry_draw>& aDraws, uint32_t aInstanceCount = 1u);
+	/**	Creates the buffers of a scene geometry and uploads all of their data with one single submission.
+	 *	@param	aUsageFlags		Additional usage flags for the vertex and index buffers (e.g. to use them as storage buffers, too)
+	 */
+	extern scene_geometry create_scene_geometry(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet = 0, bool aFlipTexCoords = false, vk::BufferUsageFlags aUsageFlags = {}, avk::sync aSyncHandler = avk::sync::wait_idle());
+
+	/**	Uploads the data of a baked animation (see animation::bake) into a device-local storage buffer, from which
+	 *	shaders can fetch the bone transforms of any frame. See baked_animation for the layout of the data.
+	 *	@param	aBakedAnimation		The baked animation to upload
+	 *	@param	aUsageFlags			Additional usage flags for the buffer
+	 *	@param	aSyncHandler		How the upload shall be synchronized
+	 */
+	extern avk::buffer create_baked_animation_buffer(const baked_animation& aBakedAnimation, vk::BufferUsageFlags aUsageFlags = {}, avk::sync aSyncHandler = avk::sync::wait_idle());
+
 	/** *cached versions for serialization */
 	extern std::tuple<std::vector<glm::vec3>, std::vector<uint32_t>> get_vertices_and_indices_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes);
 	extern std::tuple<avk::buffer, avk::buffer> create_vertex_and_index_buffers_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, vk::BufferUsageFlags aUsageFlags = {}, avk::sync aSyncHandler = avk::sync::wait_idle());
@@ -627,6 +788,9 @@ namespace gvk
 	extern avk::buffer create_2d_texture_coordinates_flipped_buffer_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet = 0, avk::sync aSyncHandler = avk::sync::wait_idle());
 	extern std::vector<glm::vec3> get_3d_texture_coordinates_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet);
 	extern avk::buffer create_3d_texture_coordinates_buffer_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet = 0, avk::sync aSyncHandler = avk::sync::wait_idle());
+	extern scene_geometry_data get_scene_geometry_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet = 0, bool aFlipTexCoords = false);
+	extern scene_geometry create_scene_geometry_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet = 0, bool aFlipTexCoords = false, vk::BufferUsageFlags aUsageFlags = {}, avk::sync aSyncHandler = avk::sync::wait_idle());
+	extern std::vector<mesh_bounds> get_mesh_bounds_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes);
 
 	extern std::tuple<std::vector<material_gpu_data>, std::vector<avk::image_sampler>> convert_for_gpu_usage_cached(
 		gvk::serializer& aSerializer,
@@ -636,6 +800,7 @@ namespace gvk
 		avk::image_usage aImageUsage = avk::image_usage::general_texture,
 		avk::filter_mode aTextureFilterMode = avk::filter_mode::trilinear,
 		avk::border_handling_mode aBorderHandlingMode = avk::border_handling_mode::repeat,
-		avk::sync aSyncHandler = avk::sync::wait_idle());
+		avk::sync aSyncHandler = avk::sync::wait_idle(),
+		bool aCompressTextures = false);
 
 }
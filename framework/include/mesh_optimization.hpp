@@ -0,0 +1,29 @@
+#pragma once
+#include <gvk.hpp>
+
+namespace gvk
+{
+	/**	Reorders the triangles of an indexed triangle list for post-transform vertex cache locality,
+	 *	using Tom Forsyth's "Linear-Speed Vertex Cache Optimisation" algorithm. The vertex indices
+	 *	themselves are not changed, i.e. the result refers to the same vertices as aIndices does.
+	 *	@param	aIndices		Indices of a triangle list, i.e. three indices per triangle
+	 *	@param	aNumVertices	The number of vertices which aIndices refers to; all indices must be smaller than that
+	 *	@param	aCacheSize		The size of the modeled LRU vertex cache
+	 *	@return	The indices of the same triangles, but in optimized order
+	 */
+	extern std::vector<uint32_t> optimize_vertex_cache(std::span<const uint32_t> aIndices, size_t aNumVertices, uint32_t aCacheSize = 32u);
+
+	/**	Determines a vertex order for vertex fetch locality, i.e. vertices are ordered by their first
+	 *	use in aIndices. Vertices which are not referenced at all, are moved to the end.
+	 *	Apply it after optimize_vertex_cache.
+	 *	@param	aIndices		Indices of a triangle list
+	 *	@param	aNumVertices	The number of vertices which aIndices refers to
+	 *	@return	A remap table: for each old vertex index, the new vertex index
+	 */
+	extern std::vector<uint32_t> optimize_vertex_fetch_remap(std::span<const uint32_t> aIndices, size_t aNumVertices);
+
+	/**	Simulates a FIFO post-transform vertex cache of the given size and returns the average number of
+	 *	cache misses per triangle (ACMR). Values range from 0.5 (for very large meshes) to 3.0 (worst case).
+	 */
+	extern float average_cache_miss_ratio(std::span<const uint32_t> aIndices, size_t aNumVertices, uint32_t aCacheSize = 16u);
+}
@@ -3,6 +3,167 @@
 
 namespace gvk
 {
+	/** Attribute types which describe the compile-time layout of interleaved vertex data.
+	 *	Pass them as template arguments to `model_t::write_interleaved_vertices_for_meshes`
+	 *	in the order in which they shall be stored within one vertex.
+	 *
+	 *	Every attribute type states the type its data is written as via `value_type`, and
+	 *	provides a `reader` which resolves the attribute's source data (or its fallback value)
+	 *	once per mesh, so that the actual per-vertex loop does not have to branch on it.
+	 *	The fallback values are the same as for the respective `model_t::*_for_mesh` getters.
+	 */
+	namespace vertex_attribute
+	{
+		/** Vertex positions, written as `glm::vec3` */
+		struct position
+		{
+			using value_type = glm::vec3;
+			struct reader
+			{
+				reader(const aiMesh* aMesh, mesh_index_t aMeshIndex) : mData{ aMesh->mVertices }
+				{
+					if (nullptr == mData) {
+						throw gvk::logic_error(fmt::format("The mesh at index {} does not contain positions.", aMeshIndex));
+					}
+				}
+				value_type operator()(size_t i) const { return value_type{ mData[i].x, mData[i].y, mData[i].z }; }
+				const aiVector3D* mData;
+			};
+		};
+
+		/** Vertex normals, written as `glm::vec3`; (0,0,1) if the mesh has no normals */
+		struct normal
+		{
+			using value_type = glm::vec3;
+			struct reader
+			{
+				reader(const aiMesh* aMesh, mesh_index_t aMeshIndex) : mData{ aMesh->mNormals }
+				{
+					if (nullptr == mData) {
+						LOG_WARNING(fmt::format("The mesh at index {} does not contain normals. Will write (0,0,1) normals for each vertex.", aMeshIndex));
+					}
+				}
+				value_type operator()(size_t i) const { return nullptr == mData ? value_type{ 0.f, 0.f, 1.f } : value_type{ mData[i].x, mData[i].y, mData[i].z }; }
+				const aiVector3D* mData;
+			};
+		};
+
+		/** Vertex tangents, written as `glm::vec3`; (1,0,0) if the mesh has no tangents */
+		struct tangent
+		{
+			using value_type = glm::vec3;
+			struct reader
+			{
+				reader(const aiMesh* aMesh, mesh_index_t aMeshIndex) : mData{ aMesh->mTangents }
+				{
+					if (nullptr == mData) {
+						LOG_WARNING(fmt::format("The mesh at index {} does not contain tangents. Will write (1,0,0) tangents for each vertex.", aMeshIndex));
+					}
+				}
+				value_type operator()(size_t i) const { return nullptr == mData ? value_type{ 1.f, 0.f, 0.f } : value_type{ mData[i].x, mData[i].y, mData[i].z }; }
+				const aiVector3D* mData;
+			};
+		};
+
+		/** Vertex bitangents, written as `glm::vec3`; (0,1,0) if the mesh has no bitangents */
+		struct bitangent
+		{
+			using value_type = glm::vec3;
+			struct reader
+			{
+				reader(const aiMesh* aMesh, mesh_index_t aMeshIndex) : mData{ aMesh->mBitangents }
+				{
+					if (nullptr == mData) {
+						LOG_WARNING(fmt::format("The mesh at index {} does not contain bitangents. Will write (0,1,0) bitangents for each vertex.", aMeshIndex));
+					}
+				}
+				value_type operator()(size_t i) const { return nullptr == mData ? value_type{ 0.f, 1.f, 0.f } : value_type{ mData[i].x, mData[i].y, mData[i].z }; }
+				const aiVector3D* mData;
+			};
+		};
+
+		/** Vertex colors of the color set `Set`, written as `glm::vec4`; opaque magenta if the mesh has no such color set */
+		template <int Set = 0>
+		struct color
+		{
+			static_assert(Set >= 0 && Set < AI_MAX_NUMBER_OF_COLOR_SETS);
+			using value_type = glm::vec4;
+			struct reader
+			{
+				reader(const aiMesh* aMesh, mesh_index_t aMeshIndex) : mData{ aMesh->mColors[Set] }
+				{
+					if (nullptr == mData) {
+						LOG_WARNING(fmt::format("The mesh at index {} does not contain a color set at index {}. Will write opaque magenta for each vertex.", aMeshIndex, Set));
+					}
+				}
+				value_type operator()(size_t i) const { return nullptr == mData ? value_type{ 1.f, 0.f, 1.f, 1.f } : value_type{ mData[i].r, mData[i].g, mData[i].b, mData[i].a }; }
+				const aiColor4D* mData;
+			};
+		};
+
+		/** Texture coordinates of the UV-set `Set`, written as `T`, which must be either `glm::vec2` or `glm::vec3`.
+		 *	Components which the UV-set does not contain, are set to zero, as are all the texture coordinates
+		 *	if the mesh has no such UV-set. If `FlipV` is true, the second component is written as `1 - v`.
+		 */
+		template <typename T = glm::vec2, int Set = 0, bool FlipV = false>
+		struct texture_coordinates
+		{
+			static_assert(std::is_same_v<T, glm::vec2> || std::is_same_v<T, glm::vec3>, "Only glm::vec2 and glm::vec3 are supported as types for texture coordinates.");
+			static_assert(Set >= 0 && Set < AI_MAX_NUMBER_OF_TEXTURECOORDS);
+			using value_type = T;
+			struct reader
+			{
+				reader(const aiMesh* aMesh, mesh_index_t aMeshIndex) : mData{ aMesh->mTextureCoords[Set] }, mNumComponents{ nullptr == mData ? 0u : aMesh->mNumUVComponents[Set] }
+				{
+					if (nullptr == mData) {
+						LOG_WARNING(fmt::format("The mesh at index {} does not contain a texture coordinates at index {}. Will write zeros for each vertex.", aMeshIndex, Set));
+					}
+					else if (mNumComponents < 1u || mNumComponents > 3u) {
+						throw gvk::logic_error(fmt::format("Can't handle a number of {} uv components for mesh at index {}, set {}.", mNumComponents, aMeshIndex, Set));
+					}
+				}
+				value_type operator()(size_t i) const
+				{
+					value_type result{ 0.f };
+					if (nullptr != mData) {
+						result[0] = mData[i].x;
+						if (mNumComponents > 1u) { result[1] = mData[i].y; }
+						if constexpr (std::is_same_v<T, glm::vec3>) {
+							if (mNumComponents > 2u) { result[2] = mData[i].z; }
+						}
+					}
+					if constexpr (FlipV) {
+						result[1] = 1.0f - result[1];
+					}
+					return result;
+				}
+				const aiVector3D* mData;
+				unsigned int mNumComponents;
+			};
+		};
+
+		/** 2D texture coordinates of the UV-set `Set` with a flipped v-coordinate, written as `glm::vec2` */
+		template <int Set = 0>
+		using texture_coordinates_flipped = texture_coordinates<glm::vec2, Set, true>;
+	}
+
+	/**	One node of a model's node hierarchy, see model_t::nodes
+	 */
+	struct model_node
+	{
+		/** The Assimp node which this entry represents */
+		const aiNode* mNode;
+
+		/** Index of the parent node within model_t::nodes; empty for the root node */
+		std::optional<size_t> mParentIndex;
+
+		/** The node's transformation relative to its parent node */
+		glm::mat4 mLocalTransform;
+
+		/** The node's transformation relative to the model, i.e. all local transformations from the root down to this node, combined */
+		glm::mat4 mGlobalTransform;
+	};
+
 	class model_t
 	{
 		friend class context_vulkan;
@@ -19,15 +180,44 @@ namespace gvk
 
 		const auto* handle() const { return mScene; }
 
+		/**	gvk-specific post-processing flag, which can be combined with Assimp's aiProcess_* flags that are passed to
+		 *	`load_from_file`, `load_from_memory`, or `orca_scene_t::load_from_file`, e.g. `aiProcess_Triangulate | model_t::sOptimizeVertexOrder`.
+		 *	It makes `optimize_vertex_order` being invoked after loading. It occupies a bit which is not used by Assimp
+		 *	and is removed before the flags are passed to Assimp. Since it is part of the flags, it is also part of the
+		 *	flags which are stored in a serializer's cache file, i.e. cache files are rebuilt when it is toggled.
+		 */
+		static constexpr aiProcessFlagsType sOptimizeVertexOrder = 0x4000u;
+
 		static avk::owning_resource<model_t> load_from_file(const std::string& aPath, aiProcessFlagsType aAssimpFlags = aiProcess_Triangulate);
 		
 		static avk::owning_resource<model_t> load_from_memory(const std::string& aMemory, aiProcessFlagsType aAssimpFlags = aiProcess_Triangulate);
 
+		/**	Reorders the triangles of all triangle meshes for post-transform vertex cache locality (see `optimize_vertex_cache`),
+		 *	and their vertices in order of first use for vertex fetch locality (see `optimize_vertex_fetch_remap`).
+		 *	All per-vertex data (incl. bone weights and animation meshes) is reordered accordingly.
+		 *	Meshes which contain other primitives than triangles are left unchanged.
+		 *	@param	aCacheSize		The size of the modeled post-transform vertex cache
+		 */
+		void optimize_vertex_order(uint32_t aCacheSize = 32u);
+
 		/** Returns this model's path where it has been loaded from */
 		auto path() const { return mModelPath; }
 
+		/** Returns the node hierarchy of this model as a flat table, which is built once after loading.
+		 *	The nodes are stored in depth-first order, i.e. every node's parent precedes it.
+		 */
+		const std::vector<model_node>& nodes() const { return mNodes; }
+
+		/** Returns the index (into `nodes()`) of the node which the mesh at the given index belongs to,
+		 *	or an empty value if no node references the mesh. If multiple nodes reference it, the first
+		 *	one in depth-first order is returned.
+		 *	@param		aMeshIndex		The index corresponding to the mesh
+		 */
+		std::optional<size_t> node_index_for_mesh(mesh_index_t aMeshIndex) const;
+
 		/** Determine the transformation matrix for the mesh at the given index.
 		 *	This matrix is also called "mesh root matrix" => see `mesh_root_matrix`!
+		 *	It is looked up in the node table (see `nodes()`) in constant time.
 		 *	@param		aMeshIndex		The index corresponding to the mesh
 		 */
 		glm::mat4 transformation_matrix_for_mesh(mesh_index_t aMeshIndex) const;
@@ -37,6 +227,37 @@ namespace gvk
 		 */
 		glm::mat4 mesh_root_matrix(mesh_index_t aMeshIndex) const;
 
+		/** Returns the bounding box and bounding sphere of the mesh at the given index in mesh space, i.e. of its
+		 *	vertex positions as they are stored. They are computed on the first access to the bounds of this
+		 *	mesh (thread-safe) and stored for subsequent accesses.
+		 *	@param		aMeshIndex		The index corresponding to the mesh
+		 */
+		const mesh_bounds& bounds_for_mesh(mesh_index_t aMeshIndex) const;
+
+		/** Returns the bounding box and bounding sphere of the mesh at the given index after its vertex positions
+		 *	have been transformed by its mesh root matrix (see `transformation_matrix_for_mesh`), i.e. in model space.
+		 *	They are computed from the transformed positions on first access, and are therefore tighter than
+		 *	the transformed mesh-space bounds. For meshes which no node references, they are the mesh-space bounds.
+		 *	@param		aMeshIndex		The index corresponding to the mesh
+		 */
+		const mesh_bounds& transformed_bounds_for_mesh(mesh_index_t aMeshIndex) const;
+
+		/** Returns the merged model-space bounds (see `transformed_bounds_for_mesh`) of all the given meshes */
+		mesh_bounds transformed_bounds_for_meshes(const std::vector<mesh_index_t>& aMeshIndices) const;
+
+		/**	Computes an oriented bounding box for each mesh (see `oriented_bounding_box_of_points`), in mesh space.
+		 *	This is not done during loading because it requires multiple passes over all vertices; the results
+		 *	are stored and can be retrieved via `oriented_bounding_box_for_mesh` afterwards.
+		 */
+		void compute_oriented_bounding_boxes();
+
+		/** Returns the mesh-space oriented bounding box of the mesh at the given index, or an empty value if
+		 *	`compute_oriented_bounding_boxes` has not been invoked. Use `transformed` together with
+		 *	`transformation_matrix_for_mesh` to get it in model space.
+		 *	@param		aMeshIndex		The index corresponding to the mesh
+		 */
+		std::optional<oriented_bounding_box> oriented_bounding_box_for_mesh(mesh_index_t aMeshIndex) const;
+
 		/**	Gets the actual number of bones that are associated to the given mesh index.
 		 *	This number corresponds exactly to what ASSIMP's data structure reflects.
 		 */
@@ -195,6 +416,26 @@ namespace gvk
 		 */
 		std::vector<glm::uvec4> bone_indices_for_mesh(mesh_index_t aMeshIndex, uint32_t aBoneIndexOffset = 0) const;
 
+		/** Gets the bone weights and the "mesh-local" bone indices for the mesh at the given index together,
+		 *	in one single pass over the mesh's bones. The results are the same as those of bone_weights_for_mesh
+		 *	and bone_indices_for_mesh, but they are cheaper to get than by invoking both of them.
+		 *	@param		aMeshIndex				The index corresponding to the mesh
+		 *  @param      aNormalizeBoneWeights	Normalize the weights, so they add up to one
+		 *	@param		aBoneIndexOffset		An offset to be added to every single bone index returned by this method.
+		 *	@return		Tuple of bone weights and bone indices, each of length `number_of_vertices_for_mesh()`
+		 */
+		std::tuple<std::vector<glm::vec4>, std::vector<glm::uvec4>> bone_weights_and_indices_for_mesh(mesh_index_t aMeshIndex, bool aNormalizeBoneWeights = false, uint32_t aBoneIndexOffset = 0) const;
+
+		/** Gets the bone weights and the "mesh-set-global" bone indices for all the given mesh indices together,
+		 *	like bone_weights_for_meshes and bone_indices_for_meshes_for_single_target_buffer, in one single pass
+		 *	over the bones of each mesh.
+		 *	@param		aMeshIndices				The indices of the meshes, in the order of their bone matrices in the single target buffer
+		 *  @param      aNormalizeBoneWeights		Normalize the weights, so they add up to one
+		 *	@param		aInitialBoneIndexOffset		An offset to be added to every single bone index returned by this method.
+		 *	@return		Tuple of bone weights and bone indices, each of accumulated length `number_of_vertices_for_mesh` for each one of the given mesh indices.
+		 */
+		std::tuple<std::vector<glm::vec4>, std::vector<glm::uvec4>> bone_weights_and_indices_for_meshes_for_single_target_buffer(const std::vector<mesh_index_t>& aMeshIndices, bool aNormalizeBoneWeights = false, uint32_t aInitialBoneIndexOffset = 0u) const;
+
 		/** Gets unique "mesh-set-global" bone indices for the mesh at the given index w.r.t. the given set of mesh indices.
 		 *	If the mesh has no bone indices, a vector filled with values is returned regardless.
 		 *
@@ -305,6 +546,108 @@ namespace gvk
 			return result;
 		}
 
+		/** Gets the accumulated number of vertices of all the given meshes.
+		 *	@param		aMeshIndices	The indices corresponding to the meshes
+		 */
+		size_t number_of_vertices_for_meshes(const std::vector<mesh_index_t>& aMeshIndices) const;
+
+		/** Gets the accumulated number of indices of all the given meshes.
+		 *	@param		aMeshIndices	The indices corresponding to the meshes
+		 */
+		size_t number_of_indices_for_meshes(const std::vector<mesh_index_t>& aMeshIndices) const;
+
+		/** Gets the size in bytes of one tightly packed vertex consisting of the given attributes.
+		 *	Use it with the types from the `vertex_attribute` namespace, e.g.
+		 *	`interleaved_vertex_size<vertex_attribute::position, vertex_attribute::normal>()`.
+		 */
+		template <typename... Attributes>
+		static constexpr size_t interleaved_vertex_size()
+		{
+			return (sizeof(typename Attributes::value_type) + ...);
+		}
+
+		/** Writes interleaved vertex data of all the given meshes directly into the given memory.
+		 *	Every mesh is traversed only once, all the requested attributes of one vertex are written
+		 *	at once, and no intermediate vectors are allocated. The target memory can, e.g., be a
+		 *	mapped staging buffer.
+		 *
+		 *	Usage example:
+		 *	`write_interleaved_vertices_for_meshes<vertex_attribute::position, vertex_attribute::normal, vertex_attribute::texture_coordinates<glm::vec2>>(meshIndices, mappedPtr);`
+		 *
+		 *	@tparam		Attributes		The vertex layout, i.e. types from the `vertex_attribute` namespace,
+		 *								in the order in which they shall be written within one vertex.
+		 *	@param		aMeshIndices	The indices corresponding to the meshes; their vertices are written in this order.
+		 *	@param		aTarget			Memory to write to. It must be large enough to hold
+		 *								`number_of_vertices_for_meshes(aMeshIndices) * aStride` bytes.
+		 *	@param		aStride			Distance in bytes between the starts of two consecutive vertices.
+		 *								Defaults to the tightly packed size of the given attributes, but
+		 *								can be larger, e.g. to match a padded vertex struct.
+		 *	@return		The number of vertices that have been written.
+		 */
+		template <typename... Attributes>
+		size_t write_interleaved_vertices_for_meshes(const std::vector<mesh_index_t>& aMeshIndices, void* aTarget, size_t aStride = interleaved_vertex_size<Attributes...>()) const
+		{
+			static_assert(sizeof...(Attributes) > 0, "At least one vertex attribute must be specified.");
+			assert(aStride >= interleaved_vertex_size<Attributes...>());
+			auto* dst = static_cast<uint8_t*>(aTarget);
+			size_t numWritten = 0;
+			for (auto meshIndex : aMeshIndices) {
+				const aiMesh* paiMesh = mScene->mMeshes[meshIndex];
+				const auto n = static_cast<size_t>(paiMesh->mNumVertices);
+				// Resolve the source data (or fallback values) of all attributes once per mesh:
+				const auto readers = std::make_tuple(typename Attributes::reader(paiMesh, meshIndex)...);
+				for (size_t i = 0; i < n; ++i) {
+					std::apply([dst, i](const auto&... bReaders) {
+						size_t offset = 0;
+						((write_vertex_attribute(dst + offset, bReaders(i)), offset += sizeof(decltype(bReaders(i)))), ...);
+					}, readers);
+					dst += aStride;
+				}
+				numWritten += n;
+			}
+			return numWritten;
+		}
+
+		/** Writes interleaved vertex data of all the given meshes directly into the given span.
+		 *	Same as the overload taking a raw pointer, but throws if the span is too small.
+		 */
+		template <typename... Attributes>
+		size_t write_interleaved_vertices_for_meshes(const std::vector<mesh_index_t>& aMeshIndices, std::span<std::byte> aTarget, size_t aStride = interleaved_vertex_size<Attributes...>()) const
+		{
+			const auto requiredSize = number_of_vertices_for_meshes(aMeshIndices) * aStride;
+			if (aTarget.size() < requiredSize) {
+				throw gvk::logic_error(fmt::format("The target span of {} bytes is too small to hold the interleaved vertex data of {} bytes.", aTarget.size(), requiredSize));
+			}
+			return write_interleaved_vertices_for_meshes<Attributes...>(aMeshIndices, static_cast<void*>(aTarget.data()), aStride);
+		}
+
+		/** Writes the indices of all the given meshes directly into the given memory.
+		 *	The indices of every mesh are offset by the accumulated number of vertices of the meshes
+		 *	before it, s.t. they match vertex data written by `write_interleaved_vertices_for_meshes`
+		 *	for the same mesh indices.
+		 *	@param		aMeshIndices	The indices corresponding to the meshes
+		 *	@param		aTarget			Memory to write to. It must be large enough to hold `number_of_indices_for_meshes(aMeshIndices)` elements.
+		 *	@param		aBaseVertex		Additional offset which is added to every single index.
+		 *	@return		The number of indices that have been written.
+		 */
+		template <typename T>
+		size_t write_indices_for_meshes(const std::vector<mesh_index_t>& aMeshIndices, T* aTarget, size_t aBaseVertex = 0) const
+		{
+			size_t numWritten = 0;
+			size_t vertexOffset = aBaseVertex;
+			for (auto meshIndex : aMeshIndices) {
+				const aiMesh* paiMesh = mScene->mMeshes[meshIndex];
+				for (unsigned int i = 0; i < paiMesh->mNumFaces; ++i) {
+					const aiFace& paiFace = paiMesh->mFaces[i];
+					for (unsigned int f = 0; f < paiFace.mNumIndices; ++f) {
+						aTarget[numWritten++] = static_cast<T>(paiFace.mIndices[f] + vertexOffset);
+					}
+				}
+				vertexOffset += paiMesh->mNumVertices;
+			}
+			return numWritten;
+		}
+
 		/** Returns the number of meshes. */
 		mesh_index_t num_meshes() const { return mScene->mNumMeshes; }
 
@@ -379,12 +722,18 @@ namespace gvk
 		animation prepare_animation(uint32_t aAnimationIndex, const std::vector<mesh_index_t>& aMeshIndices);
 		
 	private:
+		template <typename V>
+		static void write_vertex_attribute(uint8_t* aDestination, const V& aValue)
+		{
+			std::memcpy(aDestination, &aValue, sizeof(V));
+		}
+
 		void initialize_materials();
+		void initialize_node_table();
+		void initialize_mesh_bounds();
+		void compute_mesh_bounds(mesh_index_t aMeshIndex) const;
 		aiNode* find_mesh_root_node(unsigned int aMeshIndexToFind) const;
-		aiNode* mesh_node_traverser(unsigned int aMeshIndexToFind, aiNode* aNode) const;
-		std::optional<glm::mat4> transformation_matrix_traverser(unsigned int aMeshIndexToFind, const aiNode* aNode, const aiMatrix4x4& aM) const;
-		std::optional<glm::mat4> transformation_matrix_traverser_for_light(const aiLight* aLight, const aiNode* Node, const aiMatrix4x4& aM) const;
-		std::optional<glm::mat4> transformation_matrix_traverser_for_camera(const aiCamera* aCamera, const aiNode* aNode, const aiMatrix4x4& aM) const;
+		std::optional<size_t> find_node_index_by_name(const aiString& aName) const;
 
 		/** Helper function which adds the given node and all its child nodes to the given map
 		 */
@@ -410,14 +759,36 @@ namespace gvk
 			return true;
 		}
 
+		/** Appends the bone weights and/or bone indices of the given mesh to the given vectors; either one may be nullptr. */
+		void bone_weights_and_indices_for_mesh(mesh_index_t aMeshIndex, bool aNormalizeBoneWeights, uint32_t aBoneIndexOffset, std::vector<glm::vec4>* aBoneWeights, std::vector<glm::uvec4>* aBoneIndices) const;
+
 		std::unique_ptr<Assimp::Importer> mImporter;
 		std::string mModelPath;
 		const aiScene* mScene;
 		std::vector<std::optional<material_config>> mMaterialConfigPerMesh;
+		std::vector<model_node> mNodes;
+		std::vector<std::optional<size_t>> mNodeIndexPerMesh;
+		/** Both filled lazily per mesh by compute_mesh_bounds, guarded by mMeshBoundsOnceFlags */
+		mutable std::vector<mesh_bounds> mMeshBounds;
+		mutable std::vector<mesh_bounds> mTransformedMeshBounds;
+		std::unique_ptr<std::once_flag[]> mMeshBoundsOnceFlags;
+		/** Empty unless compute_oriented_bounding_boxes has been invoked */
+		std::vector<oriented_bounding_box> mOrientedBoundingBoxes;
 	};
 
 	using model = avk::owning_resource<model_t>;
 
+	/**	Quantizes bone weights to 8-bit unsigned normalized values, e.g. for a vertex attribute of format
+	 *	vk::Format::eR8G8B8A8Unorm, which takes a quarter of the memory of float weights. The weights of each
+	 *	vertex are renormalized s.t. their quantized values add up to exactly one. If all of a vertex'
+	 *	weights are zero, (1,0,0,0) is returned for it, like for meshes without bones.
+	 *	@param	aBoneWeights	Bone weights, e.g. retrieved via model_t::bone_weights_for_mesh
+	 */
+	extern std::vector<glm::u8vec4> quantize_bone_weights_unorm8(std::span<const glm::vec4> aBoneWeights);
+
+	/** Same as quantize_bone_weights_unorm8, but quantizes to 16-bit unsigned normalized values (vk::Format::eR16G16B16A16Unorm). */
+	extern std::vector<glm::u16vec4> quantize_bone_weights_unorm16(std::span<const glm::vec4> aBoneWeights);
+
 
 	template <>
 	inline std::vector<glm::vec2> model_t::texture_coordinates_for_mesh<glm::vec2>(glm::vec2(*aTransformFunc)(const glm::vec2&), mesh_index_t aMeshIndex, int aSet) const
@@ -17,6 +17,25 @@ namespace gvk
 		glm::vec3 mRotation;
 	};
 
+	/**	Returns the matrix which transforms from model space into world space for the given instance,
+	 *	i.e. its scaling, followed by its rotation (given as Euler angles), followed by its translation.
+	 */
+	static inline glm::mat4 matrix_for_instance(const model_instance_data& aInstance)
+	{
+		return matrix_from_transforms(aInstance.mTranslation, glm::quat(aInstance.mRotation), aInstance.mScaling);
+	}
+
+	/**	Transforms the given model-space bounds into world space for the given instance of the model.
+	 *	@tparam	B				Any bounding volume type for which `transformed` is defined, e.g. `aabb` or `mesh_bounds`
+	 *	@param	aModelBounds	Bounds of the instanced model in model space, see `orca_scene_t::bounds_of_model`
+	 *	@param	aInstance		The instance to get the world-space bounds for
+	 */
+	template <typename B>
+	B bounds_of_instance(const B& aModelBounds, const model_instance_data& aInstance)
+	{
+		return transformed(aModelBounds, matrix_for_instance(aInstance));
+	}
+
 	struct model_data
 	{
 		std::string mFileName;
@@ -134,7 +153,29 @@ namespace gvk
 		 */
 		std::unordered_map<material_config, std::vector<model_and_mesh_indices>> distinct_material_configs_for_all_models(bool aAlsoConsiderCpuOnlyDataForDistinctMaterials = false);
 
-		static avk::owning_resource<orca_scene_t> load_from_file(const std::string& aPath, model_t::aiProcessFlagsType aAssimpFlags = aiProcess_Triangulate | aiProcess_PreTransformVertices);
+		/**	Gets the model-space bounds of the model at the given index, i.e. the merged model-space bounds of
+		 *	all of its meshes (see `model_t::transformed_bounds_for_meshes`).
+		 *	@param	aModelIndex		The index of the model, see `models()`
+		 */
+		mesh_bounds bounds_of_model(size_t aModelIndex) const;
+
+		/**	Gets the world-space bounds of all instances of the model at the given index, i.e. its model-space
+		 *	bounds (see `bounds_of_model`) transformed by each instance (see `bounds_of_instance`).
+		 *	@param	aModelIndex		The index of the model, see `models()`
+		 *	@return	One entry per instance, in the same order as the model's `mInstances`
+		 */
+		std::vector<mesh_bounds> bounds_of_instances(size_t aModelIndex) const;
+
+		/**	Loads an ORCA scene from the given .fscene file and all the models it refers to.
+		 *	The models are independent of each other and are therefore loaded in parallel.
+		 *	The order of the models in the resulting scene is the same as in the .fscene file.
+		 *	@param	aPath			Path to the .fscene file
+		 *	@param	aAssimpFlags	Import flags which are passed to Assimp for every model
+		 *	@param	aMaxThreads		Maximum number of threads to load the models with. If 0, the
+		 *							value of `gvk::max_worker_threads()` is used. Pass 1 to load
+		 *							all the models serially on the calling thread.
+		 */
+		static avk::owning_resource<orca_scene_t> load_from_file(const std::string& aPath, model_t::aiProcessFlagsType aAssimpFlags = aiProcess_Triangulate | aiProcess_PreTransformVertices, uint32_t aMaxThreads = 0);
 
 	private:
 		std::string mLoadPath;
@@ -0,0 +1,224 @@
+#pragma once
+#include <gvk.hpp>
+
+namespace gvk
+{
+	/** Storage of the setting which is accessed through `max_worker_threads` and `set_max_worker_threads` */
+	inline std::atomic<uint32_t>& max_worker_threads_setting()
+	{
+		static std::atomic<uint32_t> sMaxWorkerThreads{ std::max(1u, std::thread::hardware_concurrency()) };
+		return sMaxWorkerThreads;
+	}
+
+	/** Gets the maximum number of worker threads which `parallel_for` uses when no
+	 *	explicit number of threads is passed to it. By default, this is the number of
+	 *	concurrent threads supported by the hardware.
+	 */
+	inline uint32_t max_worker_threads()
+	{
+		return max_worker_threads_setting().load();
+	}
+
+	/** Sets the maximum number of worker threads which `parallel_for` uses when no
+	 *	explicit number of threads is passed to it.
+	 *	@param	aMaxThreads		Number of threads. Set to 1 to have all work executed serially
+	 *							on the calling thread, set to 0 to reset it to the number of
+	 *							concurrent threads supported by the hardware.
+	 */
+	inline void set_max_worker_threads(uint32_t aMaxThreads)
+	{
+		max_worker_threads_setting().store(0u == aMaxThreads ? std::max(1u, std::thread::hardware_concurrency()) : aMaxThreads);
+	}
+
+	/**	A set of persistent worker threads which `parallel_for` distributes its work to. The threads are started
+	 *	on demand, when a `parallel_for` requests more threads than have been started so far, and they live until
+	 *	the end of the program. Use `parallel_for` instead of accessing this directly.
+	 */
+	class worker_pool
+	{
+	public:
+		/** One invocation of `parallel_for`, which idle worker threads can help with */
+		struct job
+		{
+			size_t mCount;
+			/** Invokes the function, which mFunction points to, with an index */
+			void (*mInvoke)(void*, size_t);
+			void* mFunction;
+			/** Maximum number of worker threads which may help the calling thread */
+			uint32_t mMaxHelpers;
+			std::atomic<size_t> mNextIndex{ 0 };
+			// Modified under the pool's mutex only:
+			uint32_t mNumHelpers = 0;
+			uint32_t mActiveHelpers = 0;
+			std::mutex mExceptionMutex;
+			std::exception_ptr mFirstException;
+		};
+
+		worker_pool() = default;
+		worker_pool(worker_pool&&) noexcept = delete;
+		worker_pool(const worker_pool&) = delete;
+		worker_pool& operator=(worker_pool&&) noexcept = delete;
+		worker_pool& operator=(const worker_pool&) = delete;
+		~worker_pool()
+		{
+			{
+				std::scoped_lock<std::mutex> guard(mMutex);
+				mStopping = true;
+			}
+			mWorkAvailable.notify_all();
+			for (auto& thread : mThreads) {
+				thread.join();
+			}
+		}
+
+		/** The pool which `parallel_for` uses */
+		static worker_pool& instance()
+		{
+			static worker_pool sPool;
+			return sPool;
+		}
+
+		/**	Processes all indices of the given job on the calling thread and on idle worker threads, and
+		 *	returns after all of them have been processed. Rethrows the first exception of any invocation.
+		 */
+		void run(job& aJob)
+		{
+			{
+				std::scoped_lock<std::mutex> guard(mMutex);
+				start_threads(aJob.mMaxHelpers);
+				mJobs.push_back(&aJob);
+			}
+			mWorkAvailable.notify_all();
+
+			work_on(aJob);
+
+			// Don't let any more helpers join, and wait for the active ones to finish their indices:
+			{
+				std::unique_lock<std::mutex> lock(mMutex);
+				remove_job(aJob);
+				mJobDone.wait(lock, [&aJob]() { return 0u == aJob.mActiveHelpers; });
+			}
+
+			if (aJob.mFirstException) {
+				std::rethrow_exception(aJob.mFirstException);
+			}
+		}
+
+	private:
+		/** Starts worker threads until there are at least aNumThreads. Must be invoked under mMutex. */
+		void start_threads(size_t aNumThreads)
+		{
+			while (mThreads.size() < aNumThreads) {
+				try {
+					mThreads.emplace_back([this]() { worker_loop(); });
+				}
+				catch (const std::system_error&) {
+					// Continue with the threads which could be started; the calling thread processes the job in any case.
+					break;
+				}
+			}
+		}
+
+		/** Returns a job which a worker thread can help with, or nullptr. Must be invoked under mMutex. */
+		job* find_job() const
+		{
+			for (auto* j : mJobs) {
+				if (j->mNumHelpers < j->mMaxHelpers && j->mNextIndex.load() < j->mCount) {
+					return j;
+				}
+			}
+			return nullptr;
+		}
+
+		/** Must be invoked under mMutex */
+		void remove_job(job& aJob)
+		{
+			mJobs.erase(std::remove(mJobs.begin(), mJobs.end(), &aJob), mJobs.end());
+		}
+
+		void worker_loop()
+		{
+			std::unique_lock<std::mutex> lock(mMutex);
+			for (;;) {
+				job* j = nullptr;
+				mWorkAvailable.wait(lock, [this, &j]() { return mStopping || nullptr != (j = find_job()); });
+				if (mStopping) {
+					return;
+				}
+				++j->mNumHelpers;
+				++j->mActiveHelpers;
+				lock.unlock();
+				work_on(*j);
+				lock.lock();
+				if (0u == --j->mActiveHelpers) {
+					mJobDone.notify_all();
+				}
+			}
+		}
+
+		static void work_on(job& aJob)
+		{
+			for (;;) {
+				const auto i = aJob.mNextIndex.fetch_add(1);
+				if (i >= aJob.mCount) {
+					break;
+				}
+				try {
+					aJob.mInvoke(aJob.mFunction, i);
+				}
+				catch (...) {
+					std::scoped_lock<std::mutex> guard(aJob.mExceptionMutex);
+					if (!aJob.mFirstException) {
+						aJob.mFirstException = std::current_exception();
+					}
+					aJob.mNextIndex.store(aJob.mCount); // => don't start any further work
+				}
+			}
+		}
+
+		std::mutex mMutex;
+		std::condition_variable mWorkAvailable;
+		std::condition_variable mJobDone;
+		std::vector<std::thread> mThreads;
+		std::vector<job*> mJobs;
+		bool mStopping = false;
+	};
+
+	/** Invokes the given function for every index in the range [0, aCount) on a set of worker threads.
+	 *	The calling thread participates in the work, and the function returns only after all
+	 *	invocations have completed. No guarantees are given about the order in which the indices are
+	 *	processed, therefore, to get deterministic results, `aFunction` should only write to memory
+	 *	which is exclusively owned by the index it is invoked with (e.g. the i-th element of a
+	 *	pre-sized vector).
+	 *	If any invocation throws, the remaining indices are not processed anymore and the first
+	 *	exception is rethrown on the calling thread.
+	 *
+	 *	The worker threads are persistent (see `worker_pool`), i.e. no threads are started per invocation.
+	 *	Invocations can be nested: an inner `parallel_for` is helped by worker threads which are idle at
+	 *	that time, therefore, the total number of threads never exceeds the size of the pool.
+	 *
+	 *	@param	aCount			Number of indices to process
+	 *	@param	aFunction		Function with the signature void(size_t), invoked with each index.
+	 *	@param	aMaxThreads		Maximum number of threads to use (including the calling thread).
+	 *							If 0, the value of `max_worker_threads()` is used.
+	 */
+	template <typename F>
+	void parallel_for(size_t aCount, F&& aFunction, uint32_t aMaxThreads = 0)
+	{
+		const auto numThreads = std::min(aCount, static_cast<size_t>(0u == aMaxThreads ? max_worker_threads() : aMaxThreads));
+		if (numThreads <= 1) {
+			for (size_t i = 0; i < aCount; ++i) {
+				aFunction(i);
+			}
+			return;
+		}
+
+		using function_type = std::remove_reference_t<F>;
+		worker_pool::job job;
+		job.mCount = aCount;
+		job.mInvoke = [](void* aFunctionPtr, size_t aIndex) { (*static_cast<function_type*>(aFunctionPtr))(aIndex); };
+		job.mFunction = const_cast<void*>(static_cast<const void*>(std::addressof(aFunction)));
+		job.mMaxHelpers = static_cast<uint32_t>(numThreads - 1);
+		worker_pool::instance().run(job);
+	}
+}
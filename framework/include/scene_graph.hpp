@@ -0,0 +1,255 @@
+#pragma once
+#include <gvk.hpp>
+
+namespace gvk
+{
+	class scene_graph;
+
+	/** Identifies a node of a scene_graph. A node's id never changes, even when the graph reorders its data internally. */
+	using scene_node_id_t = uint32_t;
+
+	/**	A lightweight handle to a node of a scene_graph, which offers the same interface as gvk::transform.
+	 *	Code which has been written against transforms can use it instead of transform::ptr, while the
+	 *	actual data is stored in the graph's contiguous arrays.
+	 *	A handle does not own anything; it is only valid as long as the graph it has been created from.
+	 */
+	class scene_graph_node
+	{
+	public:
+		scene_graph_node() = default;
+		scene_graph_node(scene_graph& aGraph, scene_node_id_t aId) : mGraph{ &aGraph }, mId{ aId } {}
+
+		/** True if this handle refers to a node */
+		bool is_valid() const { return nullptr != mGraph; }
+		operator bool() const { return is_valid(); }
+		bool operator==(const scene_graph_node& aOther) const { return mGraph == aOther.mGraph && mId == aOther.mId; }
+
+		/** The graph which the node belongs to */
+		scene_graph& graph() const { return *mGraph; }
+		/** The node's id within its graph */
+		scene_node_id_t id() const { return mId; }
+
+		/** sets a new position, current position is overwritten */
+		void set_translation(const glm::vec3& pValue);
+		/** sets a new rotation, current rotation is overwritten */
+		void set_rotation(const glm::quat& pValue);
+		/** sets a new scale, current scale is overwritten */
+		void set_scale(const glm::vec3& pValue);
+
+		/** returns the local transformation matrix, disregarding parent transforms */
+		glm::mat4 local_transformation_matrix() const;
+		/** Returns the inverse of the local transformation matrix. */
+		glm::mat4 inverse_local_transformation_matrix() const;
+		/** returns the global transformation matrix, taking parent transforms into account.
+		 *	If the graph has been modified since its last update_world_matrices, it is computed from the node's parent chain. */
+		glm::mat4 global_transformation_matrix() const;
+		/** returns the inverse of the global transformation matrix */
+		glm::mat4 inverse_global_transformation_matrix() const;
+
+		/** Gets the matrix' x-axis, which can be seen as the local right vector */
+		glm::vec3 x_axis() const { return local_transformation_matrix()[0]; }
+		/** Gets the matrix' y-axis, which can be seen as the local up vector */
+		glm::vec3 y_axis() const { return local_transformation_matrix()[1]; }
+		/** Gets the matrix' z-axis, which can be seen as the local back vector */
+		glm::vec3 z_axis() const { return local_transformation_matrix()[2]; }
+
+		/** Gets the local transformation matrix */
+		glm::mat4 matrix() const { return local_transformation_matrix(); }
+
+		/** Gets the local translation */
+		glm::vec3 translation() const;
+		/** Gets the local rotation */
+		glm::quat rotation() const;
+		/** Local scale vector */
+		glm::vec3 scale() const;
+
+		/* Make the front direction (a.k.a. -z) be oriented towards the given position. */
+		void look_at(const glm::vec3& aPosition);
+		/* Look along the given direction, or put differently: orient -z towards aDirection. */
+		void look_along(const glm::vec3& aDirection);
+
+		/** Returns true if this node has a parent node. */
+		bool has_parent() const;
+		/** Returns true if this node has child nodes. */
+		bool has_childs() const;
+		/** Returns the parent of this node, or an invalid handle if it has none */
+		scene_graph_node parent() const;
+
+	private:
+		scene_graph* mGraph = nullptr;
+		scene_node_id_t mId = 0;
+	};
+
+	/**	A scene graph which stores its nodes in a data-oriented way, as an alternative to hierarchies of
+	 *	transform::ptr. The local translations, rotations and scales, the local and world matrices, and the
+	 *	parent indices of all nodes are stored in contiguous arrays (structure of arrays), which are kept in
+	 *	depth-first order, i.e. every node is stored after its parent and the nodes of every subtree are
+	 *	stored contiguously. Therefore, all world matrices are computed in a single linear pass, and
+	 *	independent subtrees can be processed by multiple threads.
+	 *
+	 *	Modifications are cheap: they only mark the affected nodes. Call update_world_matrices once per frame,
+	 *	after all modifications, to bring the world matrices up to date; structural modifications (adding
+	 *	nodes, changing parents) cause the internal order to be rebuilt once during the next update.
+	 *	Use scene_graph_node (see node) to access the nodes through the interface of gvk::transform.
+	 */
+	class scene_graph
+	{
+	public:
+		/** Parent id of root nodes */
+		static constexpr scene_node_id_t sNoParent = std::numeric_limits<scene_node_id_t>::max();
+
+		scene_graph() = default;
+		scene_graph(scene_graph&&) noexcept = default;
+		scene_graph(const scene_graph&) = default;
+		scene_graph& operator=(scene_graph&&) noexcept = default;
+		scene_graph& operator=(const scene_graph&) = default;
+		~scene_graph() = default;
+
+		/** Reserves memory for the given total number of nodes */
+		void reserve(size_t aNumNodes);
+
+		/** The number of nodes in this graph */
+		size_t size() const { return mParentIds.size(); }
+
+		/**	Adds a new node to the graph.
+		 *	@param	aParent			Id of the parent node, or sNoParent to add a root node
+		 *	@return	The id of the new node. Ids are assigned consecutively, starting at 0.
+		 */
+		scene_node_id_t add_node(scene_node_id_t aParent = sNoParent, const glm::vec3& aTranslation = glm::vec3{ 0.f }, const glm::quat& aRotation = glm::quat{ 1.f, 0.f, 0.f, 0.f }, const glm::vec3& aScale = glm::vec3{ 1.f });
+
+		/**	Adds a copy of the given transform hierarchy (i.e. aRoot and all its childs, recursively) to the graph.
+		 *	@param	aRoot			The root of the hierarchy to be copied
+		 *	@param	aParent			Id of the node which aRoot's copy is attached to, or sNoParent
+		 *	@return	The id of aRoot's copy. The ids of the other nodes follow in depth-first order.
+		 */
+		scene_node_id_t add_transform_hierarchy(transform& aRoot, scene_node_id_t aParent = sNoParent);
+
+		/**	Adds one node per instance of every model of the given ORCA scene.
+		 *	@param	aParent			Id of the node which the instances' nodes are attached to, or sNoParent
+		 *	@return	For each of the scene's models (in the same order as orca_scene_t::models()),
+		 *			the ids of the nodes of its instances.
+		 */
+		std::vector<std::vector<scene_node_id_t>> add_orca_instances(const orca_scene_t& aScene, scene_node_id_t aParent = sNoParent);
+
+		/**	Attaches a node to a different parent, or detaches it if aParent is sNoParent.
+		 *	Throws a gvk::logic_error if aParent is aNode itself or one of its descendants.
+		 */
+		void set_parent(scene_node_id_t aNode, scene_node_id_t aParent);
+
+		/** Returns the parent id of the given node, or sNoParent if it is a root node */
+		scene_node_id_t parent(scene_node_id_t aNode) const { return mParentIds[aNode]; }
+		/** Returns the number of direct childs of the given node */
+		size_t number_of_childs(scene_node_id_t aNode) const { return mNumChilds[aNode]; }
+
+		/** Sets the local translation of the given node */
+		void set_translation(scene_node_id_t aNode, const glm::vec3& aTranslation);
+		/** Sets the local rotation of the given node. It is normalized before it is stored. */
+		void set_rotation(scene_node_id_t aNode, const glm::quat& aRotation);
+		/** Sets the local scale of the given node */
+		void set_scale(scene_node_id_t aNode, const glm::vec3& aScale);
+
+		/** Gets the local translation of the given node */
+		const glm::vec3& translation(scene_node_id_t aNode) const { return mTranslations[mDenseIndices[aNode]]; }
+		/** Gets the local rotation of the given node */
+		const glm::quat& rotation(scene_node_id_t aNode) const { return mRotations[mDenseIndices[aNode]]; }
+		/** Gets the local scale of the given node */
+		const glm::vec3& scale(scene_node_id_t aNode) const { return mScales[mDenseIndices[aNode]]; }
+
+		/** Returns the node's local matrix, computed from its current translation, rotation and scale */
+		glm::mat4 local_matrix(scene_node_id_t aNode) const;
+
+		/**	Returns the node's world matrix as of the last update_world_matrices. */
+		const glm::mat4& world_matrix(scene_node_id_t aNode) const { return mWorldMatrices[mDenseIndices[aNode]]; }
+
+		/**	Returns the node's current world matrix: if the graph has not been modified since the last
+		 *	update_world_matrices, that is the stored one, otherwise it is computed from the node's parent chain.
+		 */
+		glm::mat4 current_world_matrix(scene_node_id_t aNode) const;
+
+		/** True if the graph has been modified since the last update_world_matrices */
+		bool has_pending_changes() const { return mHasPendingChanges; }
+
+		/**	Brings the world matrices of all modified nodes and of their descendants up to date. Only the
+		 *	local matrices of modified nodes are recomputed; unmodified subtrees are skipped over linearly.
+		 *	@param	aMaxThreads		Maximum number of threads to use. If 0, the value of `gvk::max_worker_threads()`
+		 *							is used. Pass 1 to have all nodes processed in one pass on the calling thread.
+		 *							Nodes whose subtrees are large are processed serially first, then the remaining
+		 *							subtrees are processed in parallel, in ranges of contiguous nodes.
+		 */
+		void update_world_matrices(uint32_t aMaxThreads = 0);
+
+		/**	All world matrices as of the last update_world_matrices, in the graph's internal (depth-first) order.
+		 *	Use node_ids to map them to node ids. The order changes only if the structure of the graph is changed.
+		 */
+		std::span<const glm::mat4> world_matrices() const { return mWorldMatrices; }
+		/** The node ids in the graph's internal order, i.e. the node id of each of world_matrices' elements */
+		std::span<const scene_node_id_t> node_ids() const { return mNodeIds; }
+		/** The index of the given node in the graph's internal order (see world_matrices) */
+		size_t internal_index(scene_node_id_t aNode) const { return mDenseIndices[aNode]; }
+
+		/** Returns a handle which offers access to the given node through the interface of gvk::transform */
+		scene_graph_node node(scene_node_id_t aNode) { return scene_graph_node{ *this, aNode }; }
+
+	private:
+		/** Brings the nodes into depth-first order, and determines the subtree sizes and the parallel work ranges */
+		void rebuild_order();
+		/** Updates the local and world matrices of the internal indices [aBegin, aEnd); parents must already be up to date */
+		void update_range(uint32_t aBegin, uint32_t aEnd);
+		/** Marks the given node's matrices as outdated */
+		void mark_modified(scene_node_id_t aNode);
+
+		// Per node id:
+		/** Index into the contiguous arrays below */
+		std::vector<uint32_t> mDenseIndices;
+		/** Parent node ids; this defines the structure of the graph */
+		std::vector<scene_node_id_t> mParentIds;
+		std::vector<uint32_t> mNumChilds;
+
+		// Per node, in depth-first order (unless mOrderDirty is set, then new nodes are just appended):
+		std::vector<scene_node_id_t> mNodeIds;
+		/** Internal index of each node's parent, or sNoParent */
+		std::vector<uint32_t> mParentIndices;
+		/** Number of nodes in each node's subtree, including the node itself */
+		std::vector<uint32_t> mSubtreeSizes;
+		std::vector<glm::vec3> mTranslations;
+		std::vector<glm::quat> mRotations;
+		std::vector<glm::vec3> mScales;
+		std::vector<glm::mat4> mLocalMatrices;
+		std::vector<glm::mat4> mWorldMatrices;
+		/** Set for nodes whose translation, rotation, scale or parent has been modified. (Not a std::vector<bool> s.t. multiple threads can write to it.) */
+		std::vector<uint8_t> mModified;
+		/** Set during an update for nodes whose world matrix has changed */
+		std::vector<uint8_t> mWorldChanged;
+
+		/** Nodes whose subtrees are too large to be processed as one parallel task; they are processed serially first */
+		std::vector<uint32_t> mSerialNodes;
+		/** Ranges [begin, end) of internal indices which can be processed in parallel after mSerialNodes */
+		std::vector<std::pair<uint32_t, uint32_t>> mParallelRanges;
+
+		bool mOrderDirty = false;
+		bool mHasPendingChanges = false;
+	};
+
+	/** Attaches the child node to the parent node; both must belong to the same graph */
+	extern void attach_transform(scene_graph_node pParent, scene_graph_node pChild);
+	/** Detaches the child node from the parent node, making it a root node */
+	extern void detach_transform(scene_graph_node pParent, scene_graph_node pChild);
+
+	// The same free helper functions as for gvk::transform (see transform.hpp), s.t. code which uses them works with nodes, too.
+	// There are no counterparts of translate_wrt, rotate_wrt, and scale_wrt, because they are not implemented for transforms.
+	static glm::vec3 back (const scene_graph_node& pNode) { return  pNode.z_axis(); }
+	static glm::vec3 front(const scene_graph_node& pNode) { return -pNode.z_axis(); }
+	static glm::vec3 right(const scene_graph_node& pNode) { return  pNode.x_axis(); }
+	static glm::vec3 left (const scene_graph_node& pNode) { return -pNode.x_axis(); }
+	static glm::vec3 up   (const scene_graph_node& pNode) { return  pNode.y_axis(); }
+	static glm::vec3 down (const scene_graph_node& pNode) { return -pNode.y_axis(); }
+	extern glm::vec3 front_wrt(const scene_graph_node& pNode, glm::mat4 pReference = glm::mat4(1.0f));
+	extern glm::vec3 back_wrt (const scene_graph_node& pNode, glm::mat4 pReference = glm::mat4(1.0f));
+	extern glm::vec3 right_wrt(const scene_graph_node& pNode, glm::mat4 pReference = glm::mat4(1.0f));
+	extern glm::vec3 left_wrt (const scene_graph_node& pNode, glm::mat4 pReference = glm::mat4(1.0f));
+	extern glm::vec3 up_wrt   (const scene_graph_node& pNode, glm::mat4 pReference = glm::mat4(1.0f));
+	extern glm::vec3 down_wrt (const scene_graph_node& pNode, glm::mat4 pReference = glm::mat4(1.0f));
+	extern void translate(scene_graph_node pNode, const glm::vec3& pTranslation);
+	extern void rotate(scene_graph_node pNode, const glm::quat& pRotation);
+	extern void scale(scene_graph_node pNode, const glm::vec3& pScale);
+}
@@ -45,10 +45,149 @@ namespace gvk {
 		return std::filesystem::exists(aPath);
 	}
 
+	/** @brief Header at the very beginning of every cache file
+	 *
+	 *  A cache file consists of this header, followed by the archived data, followed by a
+	 *  table of contents. Structured data (everything passed to serializer::archive) is stored
+	 *  inline in cereal's binary format. Raw memory blocks (everything passed to
+	 *  serializer::archive_memory, serializer::archive_buffer, serializer::archive_span, and
+	 *  serializer::archive_vector) are stored as blobs which start at multiples of
+	 *  sBlobAlignment bytes, and which are listed in the table of contents. This allows blobs
+	 *  to be used directly from a memory-mapped cache file.
+	 *
+	 *  The table of contents is followed by the list of source files which the cached data has
+	 *  been created from (see cache_source_file_info), which is used to detect stale cache files.
+	 *
+	 *  The header is written last, when the serializer is destroyed, unless it is destroyed because
+	 *  an exception has been thrown while the cache file was being written. A file which has not been
+	 *  written completely, therefore, can be recognized by its invalid magic number.
+	 */
+	struct cache_file_header
+	{
+		static constexpr uint32_t sMagic = 0x434B5647u; // "GVKC"
+		static constexpr uint32_t sFormatVersion = 3u;
+		static constexpr uint64_t sBlobAlignment = 64u;
+
+		uint32_t mMagic;
+		uint32_t mFormatVersion;
+		uint64_t mBlobAlignment;
+		uint64_t mTocOffset;
+		uint64_t mTocCount;
+		uint64_t mSourceFilesOffset;
+		uint64_t mSourceFilesCount;
+		uint32_t mHasAssimpFlags;
+		uint32_t mAssimpFlags;
+		uint32_t mHasCompressTextures;
+		uint32_t mCompressTextures;
+	};
+
+	/** @brief Entry of a cache file's table of contents, describing one blob */
+	struct cache_file_toc_entry
+	{
+		uint64_t mOffset;
+		uint64_t mSize;
+	};
+
+	/** @brief Information about a source file which the data in a cache file has been created from
+	 */
+	struct cache_source_file_info
+	{
+		std::string mPath;
+		uint64_t mSize;
+		int64_t mModificationTime;
+		uint64_t mHash;
+	};
+
+	/** @brief Computes the 64-bit xxHash (XXH64) of the given memory
+	 *
+	 *  @param[in] aData Pointer to the memory to hash
+	 *  @param[in] aSize Size of the memory in bytes
+	 *  @param[in] aSeed Seed value for the hash
+	 */
+	extern uint64_t xxhash64(const void* aData, size_t aSize, uint64_t aSeed = 0);
+
+	/** @brief Gathers size, modification time and content hash of the file at the given path
+	 *
+	 *  @param[in] aPath The path to the file, throws if the file can not be read
+	 */
+	extern cache_source_file_info get_cache_source_file_info(const std::string_view aPath);
+
+	/** @brief Checks if a cache file has been written completely and in the current cache file format
+	 *
+	 *  @param[in] aPath The path to a cached file
+	 *
+	 *  @param[out] True if the cache file can be read by a serializer, false otherwise
+	 */
+	extern bool is_cache_file_compatible(const std::string_view aPath);
+
+	/** @brief Gets all the source files of a cache file which have changed since the cache file was written
+	 *
+	 *  A source file is considered unchanged if its size and modification time are the same as
+	 *  recorded, or if its size and content hash are the same as recorded. Source files which
+	 *  do not exist anymore are considered changed.
+	 *
+	 *  @param[in] aPath The path to a compatible cache file (see is_cache_file_compatible)
+	 *
+	 *  @param[out] The paths of all source files which have changed
+	 */
+	extern std::vector<std::string> stale_source_files_of_cache_file(const std::string_view aPath);
+
+	/** @brief Checks if a cache file exists, is compatible, and is up to date
+	 *
+	 *  A cache file is up to date if none of its source files has changed (see
+	 *  stale_source_files_of_cache_file), and if it has been written with the given
+	 *  Assimp flags and texture compression setting. The reason why a cache file is not
+	 *  up to date is logged.
+	 *
+	 *  @param[in] aPath The path to a cached file
+	 *  @param[in] aAssimpFlags If set, the cache file must have been written with exactly these Assimp flags
+	 *  @param[in] aCompressTextures If set, the cache file must have been written with the same setting
+	 *                               for block-compressing textures (see convert_for_gpu_usage_cached)
+	 *
+	 *  @param[out] True if the cache file can be used, false if it must be rebuilt
+	 */
+	extern bool is_cache_file_up_to_date(const std::string_view aPath, std::optional<unsigned int> aAssimpFlags = {}, std::optional<bool> aCompressTextures = {});
+
+	/** @brief Read-only memory mapping of a whole file
+	 */
+	class memory_mapped_file
+	{
+	public:
+		/** @brief Maps the whole file at the given path into memory, throws if that fails
+		 *
+		 *  @param[in] aPath The path to the file
+		 */
+		memory_mapped_file(const std::string_view aPath);
+		memory_mapped_file(memory_mapped_file&&) noexcept = delete;
+		memory_mapped_file(const memory_mapped_file&) = delete;
+		memory_mapped_file& operator=(memory_mapped_file&&) noexcept = delete;
+		memory_mapped_file& operator=(const memory_mapped_file&) = delete;
+		~memory_mapped_file();
+
+		/** @brief Returns a pointer to the first byte of the mapped file */
+		const std::byte* data() const { return mData; }
+
+		/** @brief Returns the size of the mapped file in bytes */
+		size_t size() const { return mSize; }
+
+	private:
+		const std::byte* mData = nullptr;
+		size_t mSize = 0;
+#ifdef _WIN32
+		HANDLE mFile = INVALID_HANDLE_VALUE;
+		HANDLE mMapping = nullptr;
+#else
+		int mFile = -1;
+#endif
+	};
+
 	/** @brief serializer
 	 *  
-	 *  This type serializes/deserializes objects to/from binary files using the cereal
-	 *  serialization library.
+	 *  This type serializes/deserializes objects to/from binary cache files. Structured data
+	 *  is (de)serialized using the cereal serialization library, raw memory is stored in
+	 *  aligned blobs (see cache_file_header). When deserializing, the cache file is mapped
+	 *  into memory, so that blobs can be accessed without copying them via archive_span,
+	 *  or be copied straight into (staging) buffers via archive_buffer.
 	 */
 	class serializer
 	{
@@ -74,17 +213,31 @@ namespace gvk {
 		{}
 
 		/** @brief Construct a serializer with serializing or deserializing capabilities
-		 *  If the cache file from aCacheFilePath does not exists, the serializer is initialized
-		 *  in serialization mode and creates the file for writing, else the serializer is
-		 *  initialised in deserialization mode and reads from the file.
+		 *  If the cache file from aCacheFilePath is not up to date (see is_cache_file_up_to_date),
+		 *  i.e. if it does not exist, is not compatible, has been written with different Assimp
+		 *  flags or texture compression setting, or if any of its source files has changed, the
+		 *  serializer is initialized in serialization mode and (re-)creates the file for writing,
+		 *  else the serializer is initialised in deserialization mode and reads from the file.
 		 *
 		 *  @param[in] aCacheFilePath The path to the cache file
+		 *  @param[in] aAssimpFlags The Assimp flags which the cached models are loaded with. They are
+		 *                          stored in the cache file in serialization mode.
+		 *  @param[in] aCompressTextures The value which is passed as aCompressTextures to
+		 *                               convert_for_gpu_usage_cached. It is stored in the cache file
+		 *                               in serialization mode.
 		 */
-		serializer(std::string_view aCacheFilePath) :
-			mArchive(does_cache_file_exist(aCacheFilePath) ?
+		serializer(std::string_view aCacheFilePath, std::optional<unsigned int> aAssimpFlags = {}, std::optional<bool> aCompressTextures = {}) :
+			mArchive(is_cache_file_up_to_date(aCacheFilePath, aAssimpFlags, aCompressTextures) ?
 				std::variant<deserialize, serialize>{ serializer::deserialize(aCacheFilePath) } :
 				std::variant<deserialize, serialize>{ serializer::serialize(aCacheFilePath) })
-		{}
+		{
+			if (mode() == mode::serialize && aAssimpFlags.has_value()) {
+				set_assimp_flags(aAssimpFlags.value());
+			}
+			if (mode() == mode::serialize && aCompressTextures.has_value()) {
+				set_compress_textures(aCompressTextures.value());
+			}
+		}
 
 		serializer() = delete;
 		serializer(serializer&&) noexcept = default;
@@ -102,6 +255,60 @@ namespace gvk {
 			return std::holds_alternative<serialize>(mArchive) ? mode::serialize : mode::deserialize;
 		}
 
+		/** @brief Records a file which the cached data is created from
+		 *
+		 *  The file's size, modification time and content hash are stored in the cache file, so
+		 *  that the cache file is detected as stale whenever the file changes. Add every file
+		 *  which is read while building the cache (scene files, model files, textures, ...).
+		 *  Adding the same path multiple times has no effect. Does nothing in deserialization mode.
+		 *
+		 *  @param[in] aPath The path to the source file
+		 */
+		void add_source_file(const std::string_view aPath)
+		{
+			if (mode() == mode::serialize) {
+				std::get<serialize>(mArchive).add_source_file(aPath);
+			}
+		}
+
+		/** @brief Records the Assimp flags which the cached models are loaded with
+		 *
+		 *  Does nothing in deserialization mode.
+		 *
+		 *  @param[in] aAssimpFlags The Assimp flags
+		 */
+		void set_assimp_flags(unsigned int aAssimpFlags)
+		{
+			if (mode() == mode::serialize) {
+				std::get<serialize>(mArchive).set_assimp_flags(aAssimpFlags);
+			}
+		}
+
+		/** @brief Records whether or not the cached textures are block-compressed
+		 *
+		 *  Does nothing in deserialization mode. convert_for_gpu_usage_cached invokes it.
+		 *
+		 *  @param[in] aCompressTextures The value of aCompressTextures which the textures are loaded with
+		 */
+		void set_compress_textures(bool aCompressTextures)
+		{
+			if (mode() == mode::serialize) {
+				std::get<serialize>(mArchive).set_compress_textures(aCompressTextures);
+			}
+		}
+
+		/** @brief Returns whether or not the textures in the cache file are block-compressed
+		 *
+		 *  @param[out] The recorded setting in deserialization mode, if the cache file contains it; empty otherwise
+		 */
+		std::optional<bool> compress_textures() const
+		{
+			if (mode() == mode::deserialize) {
+				return std::get<deserialize>(mArchive).compress_textures();
+			}
+			return {};
+		}
+
 		template<typename Type>
 		using BinaryData = cereal::BinaryData<Type>;
 
@@ -157,10 +364,16 @@ namespace gvk {
 		inline void archive_memory(Type&& aValue, size_t aSize)
 		{
 			if (mode() == mode::serialize) {
-				std::get<serialize>(mArchive)(binary_data(aValue, aSize));
+				std::get<serialize>(mArchive).write_blob(aValue, aSize);
 			}
 			else {
-				std::get<deserialize>(mArchive)(binary_data(aValue, aSize));
+				auto blob = std::get<deserialize>(mArchive).read_blob(aSize);
+				if constexpr (std::is_const_v<std::remove_pointer_t<std::remove_reference_t<Type>>>) {
+					throw gvk::logic_error("Can't deserialize into const memory.");
+				}
+				else {
+					std::memcpy(aValue, blob.data(), aSize);
+				}
 			}
 		}
 
@@ -170,7 +383,8 @@ namespace gvk {
 		 *  was initialized in serialization mode and deserializes the buffer content from file
 		 *  to the buffer of the internal memory_handle if the serializer was initialized in
 		 *  deserialization mode. The passed avk::buffer is internally mapped and unmapped for
-		 *  this operations.
+		 *  this operations. When deserializing, the data is copied straight from the mapped
+		 *  cache file into the buffer.
 		 *
 		 *  @param[in] aValue A pointer to the block of memory to serialize or to fill from file
 		 */
@@ -184,6 +398,50 @@ namespace gvk {
 			archive_memory(mapping.get(), size);
 		}
 
+		/** @brief Serializes/Deserializes a contiguous range of trivially copyable elements without copying
+		 *
+		 *  In serialization mode, the passed elements are written to file and the passed span is returned.
+		 *  In deserialization mode, the passed span is ignored and a span is returned which refers directly
+		 *  to the data within the memory-mapped cache file, i.e. nothing is allocated or copied.
+		 *  The returned span is valid as long as this serializer is alive.
+		 *
+		 *  @param[in] aValue The elements to serialize; ignored in deserialization mode
+		 *  @return The serialized elements, or the deserialized elements within the mapped cache file
+		 */
+		template<typename T>
+		inline std::span<const T> archive_span(std::span<const T> aValue)
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be archived as blobs.");
+			static_assert(cache_file_header::sBlobAlignment % alignof(T) == 0, "The type's alignment requirement exceeds the blob alignment.");
+			if (mode() == mode::serialize) {
+				std::get<serialize>(mArchive).write_blob(aValue.data(), aValue.size_bytes());
+				return aValue;
+			}
+			else {
+				auto blob = std::get<deserialize>(mArchive).read_blob();
+				if (blob.size() % sizeof(T) != 0) {
+					throw gvk::runtime_error(fmt::format("The size of the blob ({} bytes) is not a multiple of the element size ({} bytes).", blob.size(), sizeof(T)));
+				}
+				return std::span<const T>(reinterpret_cast<const T*>(blob.data()), blob.size() / sizeof(T));
+			}
+		}
+
+		/** @brief Serializes/Deserializes a vector of trivially copyable elements as one blob
+		 *
+		 *  In contrast to passing a vector to archive, which (de)serializes element by element, this
+		 *  function (de)serializes the vector's data as a single block of memory.
+		 *
+		 *  @param[in] aValue The vector to serialize or to fill from file
+		 */
+		template<typename T>
+		inline void archive_vector(std::vector<T>& aValue)
+		{
+			auto elements = archive_span(std::span<const T>(aValue));
+			if (mode() == mode::deserialize) {
+				aValue.assign(std::begin(elements), std::end(elements));
+			}
+		}
+
 	private:
 
 		/** @brief serialize
@@ -191,8 +449,22 @@ namespace gvk {
 		 *  This type represents an output archive to save data in binary form to a file.
 		 */
 		class serialize {
-			std::ofstream mOfstream;
-			cereal::BinaryOutputArchive mArchive;
+			struct state
+			{
+				state(const std::string_view aCacheFilePath);
+				~state();
+
+				std::ofstream mOfstream;
+				cereal::BinaryOutputArchive mArchive;
+				std::vector<cache_file_toc_entry> mToc;
+				std::vector<cache_source_file_info> mSourceFiles;
+				std::optional<unsigned int> mAssimpFlags;
+				std::optional<bool> mCompressTextures;
+				/** Number of uncaught exceptions when the state was created. If there are more when it is destroyed,
+				 *  it is destroyed during stack unwinding, i.e. the file has not been written completely. */
+				int mUncaughtExceptions;
+			};
+			std::unique_ptr<state> mState;
 
 		public:
 			serialize() = delete;
@@ -202,16 +474,10 @@ namespace gvk {
 			 *  @param[in] aCacheFilePath The filename including the full path where to save the cached file
 			 */
 			serialize(const std::string_view aCacheFilePath) :
-				mOfstream(aCacheFilePath, std::ios::binary),
-				mArchive(mOfstream)
-			{}
-
-			/* Construct from other serialize */
-			serialize(serialize&& aOther) noexcept :
-				mOfstream(std::move(aOther.mOfstream)),
-				mArchive(mOfstream)
+				mState(std::make_unique<state>(aCacheFilePath))
 			{}
 
+			serialize(serialize&&) noexcept = default;
 			serialize(const serialize&) = delete;
 			serialize& operator=(serialize&&) noexcept = default;
 			serialize& operator=(const serialize&) = delete;
@@ -226,18 +492,58 @@ namespace gvk {
 			template<typename Type>
 			void operator()(Type&& aValue)
 			{
-				mArchive(std::forward<Type>(aValue));
+				mState->mArchive(std::forward<Type>(aValue));
 			}
+
+			/** @brief Writes a block of memory as an aligned blob and adds it to the table of contents
+			 *
+			 *  @param[in] aData Pointer to the memory to write
+			 *  @param[in] aSize Size of the memory in bytes
+			 */
+			void write_blob(const void* aData, size_t aSize);
+
+			/** @brief Records a source file, see serializer::add_source_file */
+			void add_source_file(const std::string_view aPath);
+
+			/** @brief Records the Assimp flags, see serializer::set_assimp_flags */
+			void set_assimp_flags(unsigned int aAssimpFlags) { mState->mAssimpFlags = aAssimpFlags; }
+
+			/** @brief Records the texture compression setting, see serializer::set_compress_textures */
+			void set_compress_textures(bool aCompressTextures) { mState->mCompressTextures = aCompressTextures; }
 		};
 
 		/** @brief deserialize
 		 *
-		 *  This type represents an input archive to retrieve data in binary form from a file.
+		 *  This type represents an input archive to retrieve data in binary form from a memory-mapped file.
 		 */
 		class deserialize
 		{
-			std::ifstream mIfstream;
-			cereal::BinaryInputArchive mArchive;
+			/** Stream buffer which reads directly from the memory-mapped file */
+			class mapped_streambuf : public std::streambuf
+			{
+			public:
+				mapped_streambuf(const std::byte* aBegin, size_t aSize, size_t aPosition)
+				{
+					auto* begin = const_cast<char*>(reinterpret_cast<const char*>(aBegin));
+					setg(begin, begin + aPosition, begin + aSize);
+				}
+				size_t position() const { return static_cast<size_t>(gptr() - eback()); }
+				void set_position(size_t aPosition) { setg(eback(), eback() + aPosition, egptr()); }
+			};
+
+			struct state
+			{
+				state(const std::string_view aCacheFilePath);
+
+				memory_mapped_file mFile;
+				const cache_file_header* mHeader;
+				const cache_file_toc_entry* mToc;
+				size_t mNextBlob = 0;
+				mapped_streambuf mStreambuf;
+				std::istream mIstream;
+				cereal::BinaryInputArchive mArchive;
+			};
+			std::unique_ptr<state> mState;
 
 		public:
 			deserialize() = delete;
@@ -247,21 +553,21 @@ namespace gvk {
 			 *  @param[in] aCacheFilePath The filename including the full path to the binary cached file
 			 */
 			deserialize(const std::string_view aCacheFilePath) :
-				mIfstream(aCacheFilePath, std::ios::binary),
-				mArchive(mIfstream)
-			{}
-
-			/* Construct from other deserialize */
-			deserialize(deserialize&& aOther) noexcept :
-				mIfstream(std::move(aOther.mIfstream)),
-				mArchive(mIfstream)
+				mState(std::make_unique<state>(aCacheFilePath))
 			{}
 
+			deserialize(deserialize&&) noexcept = default;
 			deserialize(const deserialize&) = delete;
 			deserialize& operator=(deserialize&&) noexcept = default;
 			deserialize& operator=(const deserialize&) = delete;
 			~deserialize() = default;
 
+			/** @brief Returns the recorded texture compression setting, see serializer::compress_textures */
+			std::optional<bool> compress_textures() const
+			{
+				return 0u == mState->mHeader->mHasCompressTextures ? std::optional<bool>{} : std::optional<bool>{ 0u != mState->mHeader->mCompressTextures };
+			}
+
 			/** @brief Deserializes an Object
 			 *
 			 *  This function deserializes the object from a binary file.
@@ -271,8 +577,14 @@ namespace gvk {
 			template<typename Type>
 			void operator()(Type&& aValue)
 			{
-				mArchive(std::forward<Type>(aValue));
+				mState->mArchive(std::forward<Type>(aValue));
 			}
+
+			/** @brief Returns the next blob, directly referring to the memory-mapped file
+			 *
+			 *  @param[in] aExpectedSize If set, an exception is thrown if the blob's size differs
+			 */
+			std::span<const std::byte> read_blob(std::optional<size_t> aExpectedSize = {});
 		};
 
 		std::variant<deserialize, serialize> mArchive;
@@ -467,6 +779,41 @@ namespace gvk {
 		);
 	}
 
+	template<typename Archive>
+	void serialize(Archive& aArchive, gvk::resampled_animation_clip& aValue)
+	{
+		aArchive(
+			aValue.mAnimationIndex,
+			aValue.mTicksPerSecond,
+			aValue.mStartTicks,
+			aValue.mEndTicks,
+			aValue.mNumNodes,
+			aValue.mNumSamples,
+			aValue.mTicksPerSample,
+			aValue.mTimes,
+			aValue.mTranslations,
+			aValue.mRotations,
+			aValue.mScales
+		);
+	}
+
+	template<typename Archive>
+	void serialize(Archive& aArchive, gvk::baked_animation& aValue)
+	{
+		aArchive(
+			aValue.mAnimationIndex,
+			aValue.mTicksPerSecond,
+			aValue.mStartTicks,
+			aValue.mEndTicks,
+			aValue.mFormat,
+			aValue.mTargetSpace,
+			aValue.mFramesPerSecond,
+			aValue.mNumFrames,
+			aValue.mNumBones,
+			aValue.mData
+		);
+	}
+
 	template<typename Archive>
 	void serialize(Archive& aArchive, gvk::position_key& aValue)
 	{
@@ -0,0 +1,162 @@
+#pragma once
+#include <gvk.hpp>
+
+namespace gvk
+{
+	/**	A persistent, host-visible staging buffer from which the upload helpers sub-allocate
+	 *	their staging memory, instead of creating a new staging buffer for each upload.
+	 *
+	 *	Sub-allocations are handed out in ring-buffer order. Their memory is returned to the ring
+	 *	when the last copy of an allocation is destroyed. Therefore, an allocation must be kept
+	 *	alive until the GPU has finished reading from it, which is usually achieved by moving it
+	 *	into the custom deleter of the command buffer that reads from it. That way, memory is
+	 *	recycled as soon as the command buffer's frame in flight (or its fence) has completed.
+	 *
+	 *	Requests which do not fit into the free part of the ring, or which are larger than the
+	 *	whole ring, are served from temporary staging buffers which are freed like all the
+	 *	other allocations. Such overflows are counted in the statistics. Whenever they happen
+	 *	frequently, consider increasing the ring's capacity via set_capacity.
+	 *
+	 *	A staging ring is owned by the Vulkan context; use context().upload_staging_ring().
+	 *	All methods are thread-safe.
+	 */
+	class staging_ring
+	{
+		// Bookkeeping of one sub-allocation within the ring
+		struct ring_entry
+		{
+			size_t mBegin;
+			size_t mEnd;
+			bool mReleased;
+		};
+
+		// Shared state of an allocation, which gives the memory back when destroyed
+		struct allocation_data
+		{
+			~allocation_data();
+
+			staging_ring* mRing;
+			uint64_t mEntryId;
+			std::optional<avk::buffer> mOverflowBuffer;
+			size_t mOffset;
+			size_t mSize;
+		};
+
+	public:
+		/** Statistics about the usage of a staging ring */
+		struct statistics
+		{
+			/** The size of the ring buffer in bytes */
+			size_t mCapacity = 0;
+			/** The number of bytes of the ring buffer which are currently in use */
+			size_t mBytesInUse = 0;
+			/** The maximum value which mBytesInUse has reached */
+			size_t mHighWaterMark = 0;
+			/** The number of allocations which have been served from the ring buffer */
+			size_t mNumAllocations = 0;
+			/** The number of allocations which did not fit into the ring buffer and required a temporary staging buffer */
+			size_t mNumOverflows = 0;
+			/** The total number of bytes of all allocations counted in mNumOverflows */
+			size_t mOverflowBytes = 0;
+		};
+
+		/** A sub-allocation of the staging ring. Copies share the same memory, which is
+		 *	given back to the ring when the last copy has been destroyed.
+		 */
+		class allocation
+		{
+			friend class staging_ring;
+			allocation(std::shared_ptr<allocation_data> aData) : mData{ std::move(aData) } {}
+
+		public:
+			allocation() = default;
+
+			/** The buffer which contains this allocation; use it in conjunction with offset() */
+			avk::buffer& buffer() const;
+
+			/** The offset of this allocation within buffer() */
+			size_t offset() const { return mData->mOffset; }
+
+			/** The size of this allocation in bytes */
+			size_t size() const { return mData->mSize; }
+
+			/**	Invokes aWriter with a pointer to the first byte of this allocation.
+			 *	The ring buffer is persistently mapped; only overflow buffers are mapped for the write.
+			 *	aWriter must not write more than size() bytes.
+			 */
+			template <typename F>
+			void write(F&& aWriter) const
+			{
+				if (void* target = mapped_data(); nullptr != target) {
+					aWriter(target);
+					return;
+				}
+				auto mapping = buffer()->map_memory(avk::mapping_access::write);
+				aWriter(static_cast<void*>(static_cast<uint8_t*>(mapping.get()) + offset()));
+			}
+
+			/** Copies aSize bytes from aData into this allocation */
+			void fill(const void* aData, size_t aSize) const
+			{
+				assert(aSize <= size());
+				write([aData, aSize](void* aTarget) { std::memcpy(aTarget, aData, aSize); });
+			}
+
+		private:
+			// Pointer into the persistently mapped ring buffer, or nullptr for overflow buffers
+			void* mapped_data() const;
+
+			std::shared_ptr<allocation_data> mData;
+		};
+
+		static constexpr size_t sDefaultCapacity = 64 * 1024 * 1024;
+
+		/** Alignment which satisfies the buffer offset requirements of buffer-to-image copies for
+		 *	all color formats with texel block sizes of 1, 2, 3, 4, 6, 8, 12, or 16 bytes.
+		 */
+		static constexpr size_t sImageCopyAlignment = 48;
+
+		staging_ring() = default;
+		staging_ring(staging_ring&&) noexcept = delete;
+		staging_ring(const staging_ring&) = delete;
+		staging_ring& operator=(staging_ring&&) noexcept = delete;
+		staging_ring& operator=(const staging_ring&) = delete;
+		~staging_ring() = default;
+
+		/**	Sub-allocates aSize bytes of staging memory. The ring buffer is created lazily.
+		 *	@param	aSize		The number of bytes required
+		 *	@param	aAlignment	Required alignment of the allocation's offset within its buffer
+		 */
+		allocation allocate(size_t aSize, size_t aAlignment = 16);
+
+		/**	Changes the capacity of the ring buffer. The new capacity takes effect as soon as
+		 *	all allocations from the current ring buffer have been given back.
+		 */
+		void set_capacity(size_t aCapacity);
+
+		/** Returns the current usage statistics */
+		statistics get_statistics() const;
+
+		/** Resets the high-water mark and all counters of the statistics */
+		void reset_statistics();
+
+		/** Destroys the ring buffer. Must be invoked before the Vulkan device is destroyed. */
+		void cleanup();
+
+	private:
+		void release(uint64_t aEntryId);
+
+		mutable std::mutex mMutex;
+		size_t mCapacity = sDefaultCapacity;
+		std::optional<avk::buffer> mBuffer;
+		// Keeps mBuffer mapped for its whole lifetime (holds avk's scoped mapping); declared after mBuffer to be destroyed before it
+		std::shared_ptr<void> mMapping;
+		uint8_t* mMappedData = nullptr;
+		// All allocations from mBuffer in allocation order; mEntries.front() has the id mFirstEntryId
+		std::deque<ring_entry> mEntries;
+		uint64_t mFirstEntryId = 0;
+		size_t mHead = 0;
+		size_t mTail = 0;
+		statistics mStatistics;
+	};
+}
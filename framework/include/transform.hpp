@@ -3,7 +3,7 @@
 
 namespace gvk
 {
-	class transform : std::enable_shared_from_this<transform>
+	class transform : public std::enable_shared_from_this<transform>
 	{
 	public:
 		using ptr = std::shared_ptr<transform>;
@@ -15,13 +15,18 @@ namespace gvk
 		transform(glm::vec3 pTranslation = { 0.f, 0.f, 0.f }, glm::quat pRotation = { 1.f, 0.f, 0.f, 0.f }, glm::vec3 pScale = { 1.f, 1.f, 1.f }) noexcept;
 		/** Constructs a transform with coordinate transform basis vectors, and a translation */
 		transform(glm::vec3 pBasisX, glm::vec3 pBasisY, glm::vec3 pBasisZ, glm::vec3 pTranslation = { 0.f, 0.f, 0.f }) noexcept;
-		/** Steal the guts of another transform */
+		/** Steal the local transformation of another transform. The new transform has neither a parent nor childs,
+		 *	since it is not owned by a shared_ptr yet; other keeps its place in the hierarchy. */
 		transform(transform&& other) noexcept;
-		/** Copy of another transform */
+		/** Copy the local transformation of another transform. Like for the move constructor, the new transform
+		 *	has neither a parent nor childs. */
 		transform(const transform& other) noexcept;
-		/** Steal the guts of another transform */
+		/** Steal the local transformation and the childs of another transform. This transform keeps its parent,
+		 *	and its previous childs are detached. The childs are only moved if this transform is owned by a shared_ptr. */
 		transform& operator=(transform&& other) noexcept;
-		/** Copy of another transform */
+		/** Copy the local transformation of another transform and attach copies of its childs (recursively).
+		 *	This transform keeps its parent, and its previous childs are detached. The childs are only copied if
+		 *	this transform is owned by a shared_ptr. */
 		transform& operator=(const transform& other) noexcept;
 		virtual ~transform();
 
@@ -34,11 +39,17 @@ namespace gvk
 
 		/** returns the local transformation matrix, disregarding parent transforms */
 		glm::mat4 local_transformation_matrix() const;
-		/** Returns the inverse of the local transformation matrix. This can be used to change basis into this transform's coordinate system. */
+		/** Returns the inverse of the local transformation matrix. This can be used to change basis into this transform's coordinate system.
+		 *	It is computed lazily, i.e. only once after each modification.
+		 *	Not thread-safe: computing it writes to the cache, therefore, concurrent calls must be synchronized. */
 		glm::mat4 inverse_local_transformation_matrix() const;
-		/** returns the global transformation matrix, taking parent transforms into account */
+		/** returns the global transformation matrix, taking parent transforms into account.
+		 *	It is cached until this transform or one of its parents is modified.
+		 *	Not thread-safe: computing it writes to the caches of this transform and of its parents, therefore, concurrent
+		 *	calls on this transform or on transforms which share parents must be synchronized. */
 		glm::mat4 global_transformation_matrix() const;
-		/** returns the inverse of the global transformation matrix */
+		/** returns the inverse of the global transformation matrix; cached like the global transformation matrix.
+		 *	Not thread-safe for the same reasons as global_transformation_matrix. */
 		glm::mat4 inverse_global_transformation_matrix() const;
 
 		/** Gets the matrix' x-axis, which can be seen as the local right vector */
@@ -72,18 +83,31 @@ namespace gvk
 		bool has_childs();
 		/** Returns the parent of this transform or nullptr */
 		transform::ptr parent();
+		/** Returns the child transforms of this transform */
+		const std::vector<transform::ptr>& childs() const { return mChilds; }
 
 	private:
 		/** Updates the internal matrix based on translation, rotation scale */
 		void update_matrix_from_transforms();
 		/** Extracts translation, rotation and scale from the matrix and sets the internal fields' values */ 
 		void update_transforms_from_matrix();
+		/** Marks the cached global matrices of this transform and of all its childs (recursively) as outdated */
+		void invalidate_global_matrices();
+		/** Detaches all childs of this transform, i.e. resets their parents and invalidates their global matrices */
+		void detach_all_childs();
 
 	protected:
 		/** Orthogonal basis + translation in a 4x4 matrix */
 		glm::mat4 mMatrix;
-		/** The inverse of mMatrix */
-		glm::mat4 mInverseMatrix;
+		/** The inverse of mMatrix; only up to date if mInverseMatrixDirty is false */
+		mutable glm::mat4 mInverseMatrix;
+		/** The global transformation matrix and its inverse; only up to date if the respective dirty flag is false */
+		mutable glm::mat4 mGlobalMatrix;
+		mutable glm::mat4 mInverseGlobalMatrix;
+		/** Dirty flags of the cached matrices. (The global ones of a transform are always set if they are set for its parent.) */
+		mutable bool mInverseMatrixDirty = true;
+		mutable bool mGlobalMatrixDirty = true;
+		mutable bool mInverseGlobalMatrixDirty = true;
 		/** Offset from the coordinate origin */
 		glm::vec3 mTranslation;
 		/** Rotation quaternion */
@@ -111,6 +135,20 @@ namespace gvk
 		};
 	}
 
+	/** Returns the inverse of an affine matrix, i.e. of one whose last row is (0, 0, 0, 1), which is
+	 *	cheaper than a general 4x4 matrix inversion: only the upper-left 3x3 part is inverted.
+	 */
+	static inline glm::mat4 inverse_affine(const glm::mat4& aMatrix)
+	{
+		const glm::mat3 inverseLinear = glm::inverse(glm::mat3{ aMatrix });
+		return glm::mat4{
+			glm::vec4{ inverseLinear[0], 0.0f },
+			glm::vec4{ inverseLinear[1], 0.0f },
+			glm::vec4{ inverseLinear[2], 0.0f },
+			glm::vec4{ -(inverseLinear * glm::vec3{ aMatrix[3] }), 1.0f }
+		};
+	}
+
 	static inline std::tuple<glm::vec3, glm::quat, glm::vec3> transforms_from_matrix(glm::mat4 aMatrix)
 	{
 		auto translation = glm::vec3{aMatrix[3]};
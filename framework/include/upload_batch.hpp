@@ -0,0 +1,68 @@
+#pragma once
+#include <gvk.hpp>
+
+namespace gvk
+{
+	/**	Collects the GPU uploads of any number of buffer and image creations (e.g. create_vertex_and_index_buffers,
+	 *	create_normals_buffer, create_image_from_file, or their *_cached variants) and records them into as few
+	 *	command buffers as the staging ring allows, instead of submitting and waiting once per upload.
+	 *
+	 *	Pass the result of sync() as the sync handler to each of the functions whose upload shall become part
+	 *	of the batch. The created resources must not be used on the GPU before submit() has been invoked.
+	 *
+	 *		gvk::upload_batch batch(avk::sync::wait_idle());
+	 *		auto [positionsBuffer, indexBuffer] = gvk::create_vertex_and_index_buffers(selection, {}, batch.sync());
+	 *		auto normalsBuffer = gvk::create_normals_buffer(selection, batch.sync());
+	 *		batch.submit(); // <-- synchronized via the sync handler passed to the constructor
+	 *
+	 *	The staging memory of recorded uploads stays allocated until their command buffer has completed. Whenever
+	 *	more than half of the staging ring is in use when sync() is invoked, the uploads recorded so far are
+	 *	submitted and waited for, which gives their staging memory back to the ring. Therefore, batches of any
+	 *	size are served from the ring instead of from temporary overflow buffers.
+	 */
+	class upload_batch
+	{
+	public:
+		/**	Creates a new, empty batch.
+		 *	@param	aSyncHandler	Determines how the single submission of all the batch's uploads is synchronized.
+		 */
+		explicit upload_batch(avk::sync aSyncHandler = avk::sync::wait_idle());
+		upload_batch(upload_batch&&) noexcept = delete;
+		upload_batch(const upload_batch&) = delete;
+		upload_batch& operator=(upload_batch&&) noexcept = delete;
+		upload_batch& operator=(const upload_batch&) = delete;
+		/** Submits the batch if this has not happened yet, but logs a warning in that case. */
+		~upload_batch();
+
+		/**	Returns a sync handler which records into the batch's command buffer and does not submit anything.
+		 *	Pass it to exactly one buffer or image creation function.
+		 */
+		avk::sync sync();
+
+		/**	Submits all uploads of the batch which have not been submitted yet and synchronizes them according
+		 *	to the sync handler which has been passed to the constructor.
+		 *	@return	The command buffer, if the sync handler requested it to be returned; otherwise nothing.
+		 */
+		std::optional<avk::command_buffer> submit();
+
+		/** The number of sync handlers which have been handed out via sync() */
+		size_t number_of_operations() const { return mNumOperations; }
+
+		/** The number of intermediate submissions which were necessary to recycle staging memory */
+		size_t number_of_intermediate_submissions() const { return mNumIntermediateSubmissions; }
+
+		/** True if submit() has been invoked already */
+		bool submitted() const { return mSubmitted; }
+
+	private:
+		// Submits the operations recorded into mChunk and waits for them, so that their staging memory is given back
+		void submit_chunk();
+
+		avk::sync mSync;
+		// Records the operations since the last intermediate submission; created on demand
+		std::optional<avk::sync> mChunk;
+		size_t mNumOperations = 0;
+		size_t mNumIntermediateSubmissions = 0;
+		bool mSubmitted = false;
+	};
+}
@@ -14,30 +14,39 @@ namespace gvk
 		return animate_into_single_target_buffer(aClip, aTime, bone_matrices_space::mesh_space, aTargetMemory);
 	}
 
-	void animation::animate_into_strided_target_per_mesh(const animation_clip_data& aClip, double aTime, bone_matrices_space aTargetSpace, glm::mat4* aTargetMemory, size_t aMeshStride, std::optional<size_t> aMatricesStride, std::optional<size_t> aMaxMeshes, std::optional<size_t> aMaxBonesPerMesh)
+	// Stores bone matrices as they are:
+	static void store_bone_matrix(const glm::mat4& aBoneMatrix, uint8_t* aTarget)
+	{
+		*reinterpret_cast<glm::mat4*>(aTarget) = aBoneMatrix;
+	}
+
+	// Implements animate_into_strided_target_per_mesh for both, animation_clip_data and resampled_animation_clip,
+	// and for all output formats. aStore writes one bone matrix into the target memory at the given address.
+	template <typename C, typename S>
+	static void animate_into_strided_target_per_mesh(animation& aAnimation, const C& aClip, double aTime, bone_matrices_space aTargetSpace, uint8_t* aTargetMemory, size_t aMeshStride, size_t aMatricesStride, std::optional<size_t> aMaxMeshes, std::optional<size_t> aMaxBonesPerMesh, S aStore)
 	{
 		switch (aTargetSpace) {
 		case bone_matrices_space::mesh_space:
-			animate(aClip, aTime, [target = reinterpret_cast<uint8_t*>(aTargetMemory), meshStride = aMeshStride, matStride = aMatricesStride.value_or(sizeof(glm::mat4)), maxMeshes = aMaxMeshes.value_or(std::numeric_limits<size_t>::max()), maxBones = aMaxBonesPerMesh.value_or(std::numeric_limits<size_t>::max())]
+			aAnimation.animate(aClip, aTime, [target = aTargetMemory, meshStride = aMeshStride, matStride = aMatricesStride, maxMeshes = aMaxMeshes.value_or(std::numeric_limits<size_t>::max()), maxBones = aMaxBonesPerMesh.value_or(std::numeric_limits<size_t>::max()), aStore]
 									(mesh_bone_info aInfo, const glm::mat4& aInverseMeshRootMatrix, const glm::mat4& aTransformMatrix, const glm::mat4& aInverseBindPoseMatrix){
 										// Construction of the bone matrix for this node:
 										//   1. Bring vertex into bone space
 										//   2. Apply transformaton in bone space
 										//   3. Convert transformed vertex back to mesh space
 										if (aInfo.mMeshAnimationIndex < maxMeshes && aInfo.mMeshLocalBoneIndex < maxBones) {
-											*reinterpret_cast<glm::mat4*>(target + aInfo.mMeshAnimationIndex * meshStride + aInfo.mMeshLocalBoneIndex * matStride) = aInverseMeshRootMatrix * aTransformMatrix * aInverseBindPoseMatrix;
+											aStore(multiply_transforms(aInverseMeshRootMatrix, multiply_transforms(aTransformMatrix, aInverseBindPoseMatrix)), target + aInfo.mMeshAnimationIndex * meshStride + aInfo.mMeshLocalBoneIndex * matStride);
 										}
 									}
 			);
 			break;
 		case bone_matrices_space::model_space:
-			animate(aClip, aTime, [target = reinterpret_cast<uint8_t*>(aTargetMemory), meshStride = aMeshStride, matStride = aMatricesStride.value_or(sizeof(glm::mat4)), maxMeshes = aMaxMeshes.value_or(std::numeric_limits<size_t>::max()), maxBones = aMaxBonesPerMesh.value_or(std::numeric_limits<size_t>::max())]
+			aAnimation.animate(aClip, aTime, [target = aTargetMemory, meshStride = aMeshStride, matStride = aMatricesStride, maxMeshes = aMaxMeshes.value_or(std::numeric_limits<size_t>::max()), maxBones = aMaxBonesPerMesh.value_or(std::numeric_limits<size_t>::max()), aStore]
 									(mesh_bone_info aInfo, const glm::mat4& aInverseMeshRootMatrix, const glm::mat4& aTransformMatrix, const glm::mat4& aInverseBindPoseMatrix){
 										// Construction of the bone matrix for this node:
 										//   1. Bring vertex into bone space
 										//   2. Apply transformaton in bone space => MODEL SPACE
 										if (aInfo.mMeshAnimationIndex < maxMeshes && aInfo.mMeshLocalBoneIndex < maxBones) {
-											*reinterpret_cast<glm::mat4*>(target + aInfo.mMeshAnimationIndex * meshStride + aInfo.mMeshLocalBoneIndex * matStride) = aTransformMatrix * aInverseBindPoseMatrix;
+											aStore(multiply_transforms(aTransformMatrix, aInverseBindPoseMatrix), target + aInfo.mMeshAnimationIndex * meshStride + aInfo.mMeshLocalBoneIndex * matStride);
 										}
 									}
 			);
@@ -47,24 +56,27 @@ namespace gvk
 		}
 	}
 	
-	void animation::animate_into_single_target_buffer(const animation_clip_data& aClip, double aTime, bone_matrices_space aTargetSpace, glm::mat4* aTargetMemory)
+	// Implements animate_into_single_target_buffer for both, animation_clip_data and resampled_animation_clip,
+	// and for all output formats. Each bone transform occupies aElementSize bytes in the target memory.
+	template <typename C, typename S>
+	static void animate_into_single_target_buffer(animation& aAnimation, const C& aClip, double aTime, bone_matrices_space aTargetSpace, uint8_t* aTargetMemory, size_t aElementSize, S aStore)
 	{
 		switch (aTargetSpace) {
 		case bone_matrices_space::mesh_space:
-			animate(aClip, aTime, [aTargetMemory](mesh_bone_info aInfo, const glm::mat4& aInverseMeshRootMatrix, const glm::mat4& aTransformMatrix, const glm::mat4& aInverseBindPoseMatrix){
+			aAnimation.animate(aClip, aTime, [aTargetMemory, aElementSize, aStore](mesh_bone_info aInfo, const glm::mat4& aInverseMeshRootMatrix, const glm::mat4& aTransformMatrix, const glm::mat4& aInverseBindPoseMatrix){
 				// Construction of the bone matrix for this node:
 				//   1. Bring vertex into bone space
 				//   2. Apply transformaton in bone space
 				//   3. Convert transformed vertex back to mesh space
-				aTargetMemory[aInfo.mGlobalBoneIndexOffset + aInfo.mMeshLocalBoneIndex] = aInverseMeshRootMatrix * aTransformMatrix * aInverseBindPoseMatrix;
+				aStore(multiply_transforms(aInverseMeshRootMatrix, multiply_transforms(aTransformMatrix, aInverseBindPoseMatrix)), aTargetMemory + (aInfo.mGlobalBoneIndexOffset + aInfo.mMeshLocalBoneIndex) * aElementSize);
 			});
 			break;
 		case bone_matrices_space::model_space:
-			animate(aClip, aTime, [aTargetMemory](mesh_bone_info aInfo, const glm::mat4& aInverseMeshRootMatrix, const glm::mat4& aTransformMatrix, const glm::mat4& aInverseBindPoseMatrix){
+			aAnimation.animate(aClip, aTime, [aTargetMemory, aElementSize, aStore](mesh_bone_info aInfo, const glm::mat4& aInverseMeshRootMatrix, const glm::mat4& aTransformMatrix, const glm::mat4& aInverseBindPoseMatrix){
 				// Construction of the bone matrix for this node:
 				//   1. Bring vertex into bone space
 				//   2. Apply transformaton in bone space => MODEL SPACE
-				aTargetMemory[aInfo.mGlobalBoneIndexOffset + aInfo.mMeshLocalBoneIndex] = aTransformMatrix * aInverseBindPoseMatrix;
+				aStore(multiply_transforms(aTransformMatrix, aInverseBindPoseMatrix), aTargetMemory + (aInfo.mGlobalBoneIndexOffset + aInfo.mMeshLocalBoneIndex) * aElementSize);
 			});
 			break;
 		default:
@@ -72,6 +84,335 @@ namespace gvk
 		}
 	}
 
+	// Returns a store function for animate_into_* which writes bone matrices in the given format:
+	static auto bone_transform_store(bone_transform_format aFormat)
+	{
+		return [aFormat](const glm::mat4& aBoneMatrix, uint8_t* aTarget) {
+			store_bone_transform(aBoneMatrix, aFormat, reinterpret_cast<glm::vec4*>(aTarget));
+		};
+	}
+
+	void animation::animate_into_strided_target_per_mesh(const animation_clip_data& aClip, double aTime, bone_matrices_space aTargetSpace, glm::mat4* aTargetMemory, size_t aMeshStride, std::optional<size_t> aMatricesStride, std::optional<size_t> aMaxMeshes, std::optional<size_t> aMaxBonesPerMesh)
+	{
+		gvk::animate_into_strided_target_per_mesh(*this, aClip, aTime, aTargetSpace, reinterpret_cast<uint8_t*>(aTargetMemory), aMeshStride, aMatricesStride.value_or(sizeof(glm::mat4)), aMaxMeshes, aMaxBonesPerMesh, store_bone_matrix);
+	}
+
+	void animation::animate_into_strided_target_per_mesh(const resampled_animation_clip& aClip, double aTime, bone_matrices_space aTargetSpace, glm::mat4* aTargetMemory, size_t aMeshStride, std::optional<size_t> aMatricesStride, std::optional<size_t> aMaxMeshes, std::optional<size_t> aMaxBonesPerMesh)
+	{
+		gvk::animate_into_strided_target_per_mesh(*this, aClip, aTime, aTargetSpace, reinterpret_cast<uint8_t*>(aTargetMemory), aMeshStride, aMatricesStride.value_or(sizeof(glm::mat4)), aMaxMeshes, aMaxBonesPerMesh, store_bone_matrix);
+	}
+
+	void animation::animate_into_strided_target_per_mesh(const animation_clip_data& aClip, double aTime, bone_matrices_space aTargetSpace, bone_transform_format aFormat, glm::vec4* aTargetMemory, size_t aMeshStride, std::optional<size_t> aTransformsStride, std::optional<size_t> aMaxMeshes, std::optional<size_t> aMaxBonesPerMesh)
+	{
+		gvk::animate_into_strided_target_per_mesh(*this, aClip, aTime, aTargetSpace, reinterpret_cast<uint8_t*>(aTargetMemory), aMeshStride, aTransformsStride.value_or(sizeof(glm::vec4) * vec4s_per_bone_transform(aFormat)), aMaxMeshes, aMaxBonesPerMesh, bone_transform_store(aFormat));
+	}
+
+	void animation::animate_into_strided_target_per_mesh(const resampled_animation_clip& aClip, double aTime, bone_matrices_space aTargetSpace, bone_transform_format aFormat, glm::vec4* aTargetMemory, size_t aMeshStride, std::optional<size_t> aTransformsStride, std::optional<size_t> aMaxMeshes, std::optional<size_t> aMaxBonesPerMesh)
+	{
+		gvk::animate_into_strided_target_per_mesh(*this, aClip, aTime, aTargetSpace, reinterpret_cast<uint8_t*>(aTargetMemory), aMeshStride, aTransformsStride.value_or(sizeof(glm::vec4) * vec4s_per_bone_transform(aFormat)), aMaxMeshes, aMaxBonesPerMesh, bone_transform_store(aFormat));
+	}
+
+	void animation::animate_into_single_target_buffer(const animation_clip_data& aClip, double aTime, bone_matrices_space aTargetSpace, glm::mat4* aTargetMemory)
+	{
+		gvk::animate_into_single_target_buffer(*this, aClip, aTime, aTargetSpace, reinterpret_cast<uint8_t*>(aTargetMemory), sizeof(glm::mat4), store_bone_matrix);
+	}
+
+	void animation::animate_into_single_target_buffer(const resampled_animation_clip& aClip, double aTime, bone_matrices_space aTargetSpace, glm::mat4* aTargetMemory)
+	{
+		gvk::animate_into_single_target_buffer(*this, aClip, aTime, aTargetSpace, reinterpret_cast<uint8_t*>(aTargetMemory), sizeof(glm::mat4), store_bone_matrix);
+	}
+
+	void animation::animate_into_single_target_buffer(const animation_clip_data& aClip, double aTime, bone_matrices_space aTargetSpace, bone_transform_format aFormat, glm::vec4* aTargetMemory)
+	{
+		gvk::animate_into_single_target_buffer(*this, aClip, aTime, aTargetSpace, reinterpret_cast<uint8_t*>(aTargetMemory), sizeof(glm::vec4) * vec4s_per_bone_transform(aFormat), bone_transform_store(aFormat));
+	}
+
+	void animation::animate_into_single_target_buffer(const resampled_animation_clip& aClip, double aTime, bone_matrices_space aTargetSpace, bone_transform_format aFormat, glm::vec4* aTargetMemory)
+	{
+		gvk::animate_into_single_target_buffer(*this, aClip, aTime, aTargetSpace, reinterpret_cast<uint8_t*>(aTargetMemory), sizeof(glm::vec4) * vec4s_per_bone_transform(aFormat), bone_transform_store(aFormat));
+	}
+
+	resampled_animation_clip animation::resample_clip(const animation_clip_data& aClip, double aSamplesPerSecond) const
+	{
+		if (aClip.mTicksPerSecond == 0.0) {
+			throw gvk::runtime_error("animation_clip_data::mTicksPerSecond may not be 0.0 => set a different value!");
+		}
+		if (aClip.mAnimationIndex != mAnimationIndex) {
+			throw gvk::runtime_error("The animation index of the passed animation_clip_data is not the same that was used to create this animation.");
+		}
+		if (aSamplesPerSecond <= 0.0) {
+			throw gvk::logic_error("The number of samples per second must be greater than zero.");
+		}
+
+		resampled_animation_clip result;
+		result.mAnimationIndex = aClip.mAnimationIndex;
+		result.mTicksPerSecond = aClip.mTicksPerSecond;
+		result.mStartTicks = aClip.mStartTicks;
+		result.mEndTicks = aClip.mEndTicks;
+		result.mNumNodes = static_cast<uint32_t>(mAnimationData.size());
+
+		// Choose the number of samples s.t. the first and the last sample are exactly at the clip's start and end:
+		const double durationTicks = std::max(aClip.mEndTicks - aClip.mStartTicks, 0.0);
+		const double samplesPerTick = aSamplesPerSecond / aClip.mTicksPerSecond;
+		result.mNumSamples = std::max(2u, static_cast<uint32_t>(std::ceil(durationTicks * samplesPerTick)) + 1u);
+		result.mTicksPerSample = durationTicks > 0.0 ? durationTicks / static_cast<double>(result.mNumSamples - 1) : 1.0;
+
+		const size_t numValues = static_cast<size_t>(result.mNumSamples) * result.mNumNodes;
+		result.mTimes.resize(result.mNumSamples);
+		result.mTranslations.resize(numValues, glm::vec3{ 0.0f });
+		result.mRotations.resize(numValues, glm::quat{ 1.0f, 0.0f, 0.0f, 0.0f });
+		result.mScales.resize(numValues, glm::vec3{ 1.0f });
+
+		for (uint32_t s = 0; s < result.mNumSamples; ++s) {
+			result.mTimes[s] = static_cast<float>(static_cast<double>(s) * result.mTicksPerSample);
+		}
+
+		// Sample each node's keys with its own cursors, which advance monotonically over the samples:
+		for (size_t n = 0; n < mAnimationData.size(); ++n) {
+			const auto& anode = mAnimationData[n];
+			if (!has_keys(anode)) {
+				continue;
+			}
+			animation_key_cursors cursors;
+			for (uint32_t s = 0; s < result.mNumSamples; ++s) {
+				const double timeInTicks = s + 1 == result.mNumSamples ? aClip.mEndTicks : aClip.mStartTicks + static_cast<double>(s) * result.mTicksPerSample;
+				const size_t i = static_cast<size_t>(s) * result.mNumNodes + n;
+				std::tie(result.mTranslations[i], result.mRotations[i], result.mScales[i]) = interpolate_keys(anode, timeInTicks, cursors);
+			}
+		}
+
+		return result;
+	}
+
+	baked_animation animation::bake(const animation_clip_data& aClip, double aFramesPerSecond, bone_transform_format aFormat, bone_matrices_space aTargetSpace) const
+	{
+		if (aClip.mTicksPerSecond == 0.0) {
+			throw gvk::runtime_error("animation_clip_data::mTicksPerSecond may not be 0.0 => set a different value!");
+		}
+		if (aFramesPerSecond <= 0.0) {
+			throw gvk::logic_error("The number of frames per second must be greater than zero.");
+		}
+
+		baked_animation result;
+		result.mAnimationIndex = aClip.mAnimationIndex;
+		result.mTicksPerSecond = aClip.mTicksPerSecond;
+		const auto keyTimes = animation_key_times_within_clip(aClip);
+		result.mStartTicks = keyTimes.empty() ? aClip.mStartTicks : keyTimes.front();
+		result.mEndTicks = keyTimes.empty() ? aClip.mEndTicks : keyTimes.back();
+		result.mFormat = aFormat;
+		result.mTargetSpace = aTargetSpace;
+		result.mNumBones = static_cast<uint32_t>(number_of_bone_matrices());
+
+		// Choose the number of frames s.t. the first and the last frame are exactly at the start and the end:
+		const double durationSeconds = std::max(result.mEndTicks - result.mStartTicks, 0.0) / aClip.mTicksPerSecond;
+		result.mNumFrames = std::max(2u, static_cast<uint32_t>(std::ceil(durationSeconds * aFramesPerSecond)) + 1u);
+		result.mFramesPerSecond = durationSeconds > 0.0 ? static_cast<double>(result.mNumFrames - 1) / durationSeconds : aFramesPerSecond;
+		result.mData.resize(result.frame_offset(result.mNumFrames));
+
+		// Sample with a copy at full detail, s.t. neither this instance's playback state nor its LOD are involved:
+		animation instance = *this;
+		instance.set_lod({});
+		for (uint32_t f = 0; f < result.mNumFrames; ++f) {
+			const double timeInSeconds = f + 1 == result.mNumFrames
+				? result.mEndTicks / aClip.mTicksPerSecond
+				: result.mStartTicks / aClip.mTicksPerSecond + static_cast<double>(f) / result.mFramesPerSecond;
+			auto* target = result.mData.data() + result.frame_offset(f);
+			instance.animate_into_single_target_buffer(aClip, timeInSeconds, aTargetSpace, aFormat, target);
+			if (bone_transform_format::dual_quaternion == aFormat && f > 0) {
+				// Keep consecutive frames in the same hemisphere, s.t. they can be blended with each other:
+				const auto* previous = result.mData.data() + result.frame_offset(f - 1);
+				for (uint32_t b = 0; b < result.mNumBones; ++b) {
+					if (glm::dot(target[2 * b], previous[2 * b]) < 0.0f) {
+						target[2 * b] = -target[2 * b];
+						target[2 * b + 1] = -target[2 * b + 1];
+					}
+				}
+			}
+		}
+		return result;
+	}
+
+	// The number of bits per component of the "smallest three" rotation formats:
+	static int smallest_three_bits(rotation_quantization aQuantization)
+	{
+		switch (aQuantization) {
+		case rotation_quantization::smallest_three_32bit:
+			return 10;
+		case rotation_quantization::smallest_three_48bit:
+			return 15;
+		default:
+			throw gvk::logic_error("Rotations can only be (de)quantized with one of the smallest_three formats.");
+		}
+	}
+
+	uint64_t quantize_rotation(const glm::quat& aRotation, rotation_quantization aQuantization)
+	{
+		const int bits = smallest_three_bits(aQuantization);
+		const uint32_t maxValue = (1u << bits) - 1u;
+		const glm::vec4 q = glm::normalize(glm::vec4{ aRotation.x, aRotation.y, aRotation.z, aRotation.w });
+		int largest = 0;
+		for (int i = 1; i < 4; ++i) {
+			if (std::abs(q[i]) > std::abs(q[largest])) {
+				largest = i;
+			}
+		}
+		// q and -q represent the same rotation => make the largest component positive, s.t. it does not need a sign bit.
+		// All the other components are then within [-1/sqrt(2), 1/sqrt(2)]:
+		const float sign = q[largest] < 0.0f ? -1.0f : 1.0f;
+		uint64_t result = static_cast<uint64_t>(largest);
+		int shift = 2;
+		for (int i = 0; i < 4; ++i) {
+			if (i != largest) {
+				const float unorm = glm::clamp((q[i] * sign * glm::root_two<float>() + 1.0f) * 0.5f, 0.0f, 1.0f);
+				result |= static_cast<uint64_t>(std::lround(unorm * static_cast<float>(maxValue))) << shift;
+				shift += bits;
+			}
+		}
+		return result;
+	}
+
+	glm::quat dequantize_rotation(uint64_t aQuantized, rotation_quantization aQuantization)
+	{
+		const int bits = smallest_three_bits(aQuantization);
+		const uint32_t maxValue = (1u << bits) - 1u;
+		const int largest = static_cast<int>(aQuantized & 3u);
+		glm::vec4 q{ 0.0f };
+		float sumOfSquares = 0.0f;
+		int shift = 2;
+		for (int i = 0; i < 4; ++i) {
+			if (i != largest) {
+				const float unorm = static_cast<float>((aQuantized >> shift) & maxValue) / static_cast<float>(maxValue);
+				q[i] = (unorm * 2.0f - 1.0f) / glm::root_two<float>();
+				sumOfSquares += q[i] * q[i];
+				shift += bits;
+			}
+		}
+		q[largest] = std::sqrt(std::max(0.0f, 1.0f - sumOfSquares));
+		q = glm::normalize(q);
+		return glm::quat{ q.w, q.x, q.y, q.z };
+	}
+
+	// Removes the keys of one channel which can be reproduced by interpolating between their remaining neighbours
+	// within aMaxError. aKeys are the keys to reduce, aOriginalKeys the unmodified keys (i.e. before quantization),
+	// which all errors are measured against. aInterpolate must interpolate like animate does, aError must return
+	// the error of a value w.r.t. an original value. At least one key is kept. Returns the maximum error.
+	template <typename K, typename I, typename E>
+	static float reduce_keys(std::vector<K>& aKeys, const std::vector<K>& aOriginalKeys, float aMaxError, I aInterpolate, E aError)
+	{
+		assert(aKeys.size() == aOriginalKeys.size());
+		const size_t n = aKeys.size();
+		if (n < 2) {
+			return 0 == n ? 0.0f : aError(aOriginalKeys[0].mValue, aKeys[0].mValue);
+		}
+
+		// Returns the maximum error of the keys between aFirst and aLast if they are replaced by interpolating between aFirst and aLast:
+		auto segmentError = [&](size_t aFirst, size_t aLast) {
+			float maxError = 0.0f;
+			const double timeDifference = aKeys[aLast].mTime - aKeys[aFirst].mTime;
+			for (size_t k = aFirst + 1; k < aLast; ++k) {
+				const float factor = std::abs(timeDifference) < std::numeric_limits<double>::epsilon() ? 1.0f : static_cast<float>((aKeys[k].mTime - aKeys[aFirst].mTime) / timeDifference);
+				maxError = std::max(maxError, aError(aOriginalKeys[k].mValue, aInterpolate(aKeys[aFirst].mValue, aKeys[aLast].mValue, factor)));
+			}
+			return maxError;
+		};
+
+		float maxError = 0.0f;
+		for (size_t k = 0; k < n; ++k) {
+			maxError = std::max(maxError, aError(aOriginalKeys[k].mValue, aKeys[k].mValue));
+		}
+
+		// A channel whose values all lie within the bound around its first value, is reduced to that one key:
+		bool isConstant = true;
+		for (size_t k = 1; k < n && isConstant; ++k) {
+			isConstant = aError(aOriginalKeys[k].mValue, aKeys[0].mValue) <= aMaxError;
+		}
+		if (isConstant) {
+			for (size_t k = 0; k < n; ++k) {
+				maxError = std::max(maxError, aError(aOriginalKeys[k].mValue, aKeys[0].mValue));
+			}
+			aKeys.resize(1);
+			return maxError;
+		}
+
+		// Greedily extend each segment as long as all the keys within it can be removed:
+		std::vector<K> result;
+		result.push_back(aKeys[0]);
+		size_t first = 0;
+		while (first + 1 < n) {
+			size_t last = first + 1;
+			float error = 0.0f;
+			while (last + 1 < n) {
+				const float candidateError = segmentError(first, last + 1);
+				if (candidateError > aMaxError) {
+					break;
+				}
+				error = candidateError;
+				++last;
+			}
+			maxError = std::max(maxError, error);
+			result.push_back(aKeys[last]);
+			first = last;
+		}
+		aKeys = std::move(result);
+		return maxError;
+	}
+
+	// True if both key collections have the same number of keys, with the same times:
+	template <typename T1, typename T2>
+	static bool have_same_key_times(const T1& aCollection1, const T2& aCollection2)
+	{
+		return aCollection1.size() == aCollection2.size() && std::equal(std::begin(aCollection1), std::end(aCollection1), std::begin(aCollection2), [](const auto& aKey1, const auto& aKey2) { return aKey1.mTime == aKey2.mTime; });
+	}
+
+	animation_compression_stats animation::compress_keys(const animation_compression_settings& aSettings)
+	{
+		if (aSettings.mMaxRotationError < max_rotation_quantization_error(aSettings.mRotationQuantization)) {
+			throw gvk::logic_error(fmt::format("The maximum rotation error of {:g} radians is below the error of the requested rotation quantization, which is up to {:g} radians.", aSettings.mMaxRotationError, max_rotation_quantization_error(aSettings.mRotationQuantization)));
+		}
+
+		animation_compression_stats stats;
+		for (auto& anode : mAnimationData) {
+			stats.mKeysBefore += anode.mPositionKeys.size() + anode.mRotationKeys.size() + anode.mScalingKeys.size();
+			stats.mBytesBefore += sizeof(position_key) * anode.mPositionKeys.size() + sizeof(rotation_key) * anode.mRotationKeys.size() + sizeof(scaling_key) * anode.mScalingKeys.size();
+
+			const auto originalPositionKeys = anode.mPositionKeys;
+			stats.mMaxPositionError = std::max(stats.mMaxPositionError, reduce_keys(anode.mPositionKeys, originalPositionKeys, aSettings.mMaxPositionError,
+				[](const glm::vec3& a, const glm::vec3& b, float f) { return glm::lerp(a, b, f); },
+				[](const glm::vec3& aOriginal, const glm::vec3& aValue) { return glm::distance(aOriginal, aValue); }
+			));
+
+			const auto originalRotationKeys = anode.mRotationKeys;
+			if (rotation_quantization::none != aSettings.mRotationQuantization) {
+				for (auto& key : anode.mRotationKeys) {
+					key.mValue = dequantize_rotation(quantize_rotation(key.mValue, aSettings.mRotationQuantization), aSettings.mRotationQuantization);
+				}
+			}
+			stats.mMaxRotationError = std::max(stats.mMaxRotationError, reduce_keys(anode.mRotationKeys, originalRotationKeys, aSettings.mMaxRotationError,
+				[](const glm::quat& a, const glm::quat& b, float f) { return glm::normalize(glm::slerp(a, b, f)); },
+				[](const glm::quat& aOriginal, const glm::quat& aValue) {
+					// The angle of the rotation between them (via atan2, which is accurate for small angles, unlike acos):
+					const glm::quat difference = glm::conjugate(glm::normalize(aOriginal)) * glm::normalize(aValue);
+					return 2.0f * std::atan2(glm::length(glm::vec3{ difference.x, difference.y, difference.z }), std::abs(difference.w));
+				}
+			));
+
+			const auto originalScalingKeys = anode.mScalingKeys;
+			stats.mMaxScalingError = std::max(stats.mMaxScalingError, reduce_keys(anode.mScalingKeys, originalScalingKeys, aSettings.mMaxScalingError,
+				[](const glm::vec3& a, const glm::vec3& b, float f) { return glm::lerp(a, b, f); },
+				[](const glm::vec3& aOriginal, const glm::vec3& aValue) { return glm::distance(aOriginal, aValue); }
+			));
+
+			// The channels have been reduced independently => their key times might differ now:
+			anode.mSameRotationAndPositionKeyTimes = have_same_key_times(anode.mPositionKeys, anode.mRotationKeys);
+			anode.mSameScalingAndPositionKeyTimes = have_same_key_times(anode.mPositionKeys, anode.mScalingKeys);
+			anode.mKeyCursors = {};
+
+			stats.mKeysAfter += anode.mPositionKeys.size() + anode.mRotationKeys.size() + anode.mScalingKeys.size();
+			stats.mBytesAfter += sizeof(position_key) * anode.mPositionKeys.size() + sizeof(rotation_key) * anode.mRotationKeys.size() + sizeof(scaling_key) * anode.mScalingKeys.size();
+		}
+		return stats;
+	}
+
 	std::vector<double> animation::animation_key_times_within_clip(const animation_clip_data& aClip) const
 	{
 		std::set<double> mUniqueKeys;
@@ -99,6 +440,63 @@ namespace gvk
 		return result;
 	}
 
+	size_t animation::number_of_bone_matrices() const
+	{
+		size_t result = 0;
+		for (const auto& anode : mAnimationData) {
+			for (const auto& target : anode.mBoneMeshTargets) {
+				result = std::max(result, target.mMeshBoneInfo.mGlobalBoneIndexOffset + static_cast<size_t>(target.mMeshBoneInfo.mMeshLocalBoneIndex) + 1);
+			}
+		}
+		return result;
+	}
+
+	void animation::set_lod(animation_lod aLod)
+	{
+		if (0u == aLod.mUpdateInterval) {
+			throw gvk::logic_error("animation_lod::mUpdateInterval must be at least 1.");
+		}
+		mLod = std::move(aLod);
+
+		// Mark all nodes within the skipped subtrees. Parents precede their children, hence one pass is sufficient:
+		mSkippedNodes.clear();
+		if (!mLod.mSkippedSubtrees.empty()) {
+			const auto n = mAnimationData.size();
+			mSkippedNodes.resize(n, 0);
+			for (auto nodeIndex : mLod.mSkippedSubtrees) {
+				if (nodeIndex >= n) {
+					throw gvk::logic_error(fmt::format("Node index {} of animation_lod::mSkippedSubtrees is out of range for {} animated nodes.", nodeIndex, n));
+				}
+				mSkippedNodes[nodeIndex] = 1;
+			}
+			for (size_t i = 0; i < n; ++i) {
+				if (mAnimationData[i].mAnimatedParentIndex.has_value() && 0 != mSkippedNodes[mAnimationData[i].mAnimatedParentIndex.value()]) {
+					mSkippedNodes[i] = 1;
+				}
+			}
+		}
+
+		// Evaluate the pose during the next frame:
+		mLodFrame = 0u;
+		mHasPose = false;
+	}
+
+	void animation::set_lod_selector(std::function<animation_lod(float)> aSelector)
+	{
+		mLodSelector = std::move(aSelector);
+	}
+
+	void animation::update_lod_for_distance(float aDistance)
+	{
+		if (!mLodSelector) {
+			throw gvk::logic_error("No LOD selector has been set via animation::set_lod_selector.");
+		}
+		auto lod = mLodSelector(aDistance);
+		if (lod != mLod) {
+			set_lod(std::move(lod));
+		}
+	}
+
 	size_t animation::number_of_animated_nodes() const
 	{
 		return mAnimationData.size();
@@ -151,4 +549,146 @@ namespace gvk
 		}
 		return result;
 	}
+
+	std::function<animation_lod(float)> distance_based_lod_selector(std::vector<std::tuple<float, animation_lod>> aLevels)
+	{
+		std::sort(std::begin(aLevels), std::end(aLevels), [](const auto& a, const auto& b) { return std::get<float>(a) < std::get<float>(b); });
+		return [lLevels = std::move(aLevels)](float aDistance) {
+			animation_lod result;
+			for (const auto& [minDistance, lod] : lLevels) {
+				if (aDistance < minDistance) {
+					break;
+				}
+				result = lod;
+			}
+			return result;
+		};
+	}
+
+	// Implements animate_into_single_target_buffer_in_parallel for all output formats.
+	// aAnimateInto(entry, offset) evaluates one instance into the target memory, starting at the given bone index.
+	template <typename F>
+	static std::vector<size_t> animate_in_parallel(std::span<const animation_batch_entry> aEntries, uint32_t aMaxThreads, F aAnimateInto)
+	{
+		// Animation instances store their current pose and key cursors => they must not be evaluated concurrently:
+		std::vector<const animation*> instances;
+		instances.reserve(aEntries.size());
+		for (const auto& entry : aEntries) {
+			instances.push_back(entry.mAnimation);
+		}
+		std::sort(std::begin(instances), std::end(instances));
+		if (std::adjacent_find(std::begin(instances), std::end(instances)) != std::end(instances)) {
+			throw gvk::logic_error("An animation instance is contained multiple times in the batch passed to animate_into_single_target_buffer_in_parallel.");
+		}
+
+		std::vector<size_t> offsets(aEntries.size());
+		size_t offset = 0;
+		for (size_t i = 0; i < aEntries.size(); ++i) {
+			offsets[i] = offset;
+			offset += aEntries[i].mAnimation->number_of_bone_matrices();
+		}
+
+		parallel_for(aEntries.size(), [&](size_t i) {
+			aAnimateInto(aEntries[i], offsets[i]);
+		}, aMaxThreads);
+
+		return offsets;
+	}
+
+	std::vector<size_t> animate_into_single_target_buffer_in_parallel(std::span<const animation_batch_entry> aEntries, bone_matrices_space aTargetSpace, glm::mat4* aTargetMemory, uint32_t aMaxThreads)
+	{
+		return animate_in_parallel(aEntries, aMaxThreads, [aTargetSpace, aTargetMemory](const animation_batch_entry& aEntry, size_t aOffset) {
+			if (nullptr != aEntry.mResampledClip) {
+				aEntry.mAnimation->animate_into_single_target_buffer(*aEntry.mResampledClip, aEntry.mTime, aTargetSpace, aTargetMemory + aOffset);
+			}
+			else {
+				aEntry.mAnimation->animate_into_single_target_buffer(aEntry.mClip, aEntry.mTime, aTargetSpace, aTargetMemory + aOffset);
+			}
+		});
+	}
+
+	std::vector<size_t> animate_into_single_target_buffer_in_parallel(std::span<const animation_batch_entry> aEntries, bone_matrices_space aTargetSpace, bone_transform_format aFormat, glm::vec4* aTargetMemory, uint32_t aMaxThreads)
+	{
+		const size_t vec4sPerBone = vec4s_per_bone_transform(aFormat);
+		return animate_in_parallel(aEntries, aMaxThreads, [aTargetSpace, aFormat, aTargetMemory, vec4sPerBone](const animation_batch_entry& aEntry, size_t aOffset) {
+			if (nullptr != aEntry.mResampledClip) {
+				aEntry.mAnimation->animate_into_single_target_buffer(*aEntry.mResampledClip, aEntry.mTime, aTargetSpace, aFormat, aTargetMemory + aOffset * vec4sPerBone);
+			}
+			else {
+				aEntry.mAnimation->animate_into_single_target_buffer(aEntry.mClip, aEntry.mTime, aTargetSpace, aFormat, aTargetMemory + aOffset * vec4sPerBone);
+			}
+		});
+	}
+
+	// Linearly blends the (up to) four bone transforms of a vertex into one bone matrix:
+	static glm::mat4 blend_bone_matrices(const glm::uvec4& aBoneIndices, const glm::vec4& aBoneWeights, const glm::vec4* aBoneTransforms, bone_transform_format aFormat)
+	{
+		const auto vec4sPerBone = vec4s_per_bone_transform(aFormat);
+		glm::mat4 result{ 0.0f };
+		for (int i = 0; i < 4; ++i) {
+			if (0.0f != aBoneWeights[i]) {
+				result += load_bone_transform(aBoneTransforms + static_cast<size_t>(aBoneIndices[i]) * vec4sPerBone, aFormat) * aBoneWeights[i];
+			}
+		}
+		return result;
+	}
+
+	// Dual quaternion linear blending of the (up to) four bone transforms of a vertex. All of them are
+	// blended in the hemisphere of the first one, and the result is normalized:
+	static glm::dualquat blend_dual_quaternions(const glm::uvec4& aBoneIndices, const glm::vec4& aBoneWeights, const glm::vec4* aBoneTransforms)
+	{
+		glm::vec4 real{ 0.0f };
+		glm::vec4 dual{ 0.0f };
+		std::optional<glm::vec4> firstReal;
+		for (int i = 0; i < 4; ++i) {
+			if (0.0f != aBoneWeights[i]) {
+				const auto* dq = aBoneTransforms + 2 * static_cast<size_t>(aBoneIndices[i]);
+				if (!firstReal.has_value()) {
+					firstReal = dq[0];
+				}
+				const float weight = glm::dot(dq[0], *firstReal) < 0.0f ? -aBoneWeights[i] : aBoneWeights[i];
+				real += dq[0] * weight;
+				dual += dq[1] * weight;
+			}
+		}
+		// Without any (effective) weights, there is nothing to blend => leave the vertex untransformed:
+		const float length = glm::length(real);
+		if (length < std::numeric_limits<float>::epsilon()) {
+			return glm::dualquat{ glm::quat{ 1.0f, 0.0f, 0.0f, 0.0f }, glm::quat{ 0.0f, 0.0f, 0.0f, 0.0f } };
+		}
+		const float oneOverLength = 1.0f / length;
+		real *= oneOverLength;
+		dual *= oneOverLength;
+		return glm::dualquat{ glm::quat{ real.w, real.x, real.y, real.z }, glm::quat{ dual.w, dual.x, dual.y, dual.z } };
+	}
+
+	glm::vec3 skin_position(const glm::vec3& aPosition, const glm::uvec4& aBoneIndices, const glm::vec4& aBoneWeights, const glm::vec4* aBoneTransforms, bone_transform_format aFormat)
+	{
+		if (bone_transform_format::dual_quaternion == aFormat) {
+			const auto dq = blend_dual_quaternions(aBoneIndices, aBoneWeights, aBoneTransforms);
+			const glm::quat translation = (dq.dual * 2.0f) * glm::conjugate(dq.real);
+			return dq.real * aPosition + glm::vec3{ translation.x, translation.y, translation.z };
+		}
+		return glm::vec3{ blend_bone_matrices(aBoneIndices, aBoneWeights, aBoneTransforms, aFormat) * glm::vec4{ aPosition, 1.0f } };
+	}
+
+	glm::vec3 skin_normal(const glm::vec3& aNormal, const glm::uvec4& aBoneIndices, const glm::vec4& aBoneWeights, const glm::vec4* aBoneTransforms, bone_transform_format aFormat)
+	{
+		if (bone_transform_format::dual_quaternion == aFormat) {
+			return glm::normalize(blend_dual_quaternions(aBoneIndices, aBoneWeights, aBoneTransforms).real * aNormal);
+		}
+		return glm::normalize(glm::mat3{ blend_bone_matrices(aBoneIndices, aBoneWeights, aBoneTransforms, aFormat) } * aNormal);
+	}
+
+	std::vector<glm::vec3> skin_positions(std::span<const glm::vec3> aPositions, std::span<const glm::uvec4> aBoneIndices, std::span<const glm::vec4> aBoneWeights, const glm::vec4* aBoneTransforms, bone_transform_format aFormat)
+	{
+		if (aBoneIndices.size() != aPositions.size() || aBoneWeights.size() != aPositions.size()) {
+			throw gvk::logic_error(fmt::format("skin_positions requires one set of bone indices and weights per position, but got {} positions, {} bone indices, and {} bone weights.", aPositions.size(), aBoneIndices.size(), aBoneWeights.size()));
+		}
+		std::vector<glm::vec3> result(aPositions.size());
+		for (size_t i = 0; i < aPositions.size(); ++i) {
+			result[i] = skin_position(aPositions[i], aBoneIndices[i], aBoneWeights[i], aBoneTransforms, aFormat);
+		}
+		return result;
+	}
 }
@@ -0,0 +1,193 @@
+#include <gvk.hpp>
+
+namespace gvk
+{
+	// The scalar implementations use the same order of operations as the SSE2 implementations,
+	// s.t. the results do not depend on how many elements are processed by which of them.
+
+	static glm::quat blend_rotation(const glm::quat& aFrom, const glm::quat& aTo, float aFactor)
+	{
+		float dot = aFrom.x * aTo.x + aFrom.y * aTo.y + aFrom.z * aTo.z + aFrom.w * aTo.w;
+		glm::quat to = aTo;
+		if (dot < 0.0f) {
+			// Take the shortest path:
+			to = -aTo;
+			dot = -dot;
+		}
+		if (dot < sNlerpThreshold) {
+			return glm::normalize(glm::slerp(aFrom, aTo, aFactor));
+		}
+		const float f0 = 1.0f - aFactor;
+		const float x = aFrom.x * f0 + to.x * aFactor;
+		const float y = aFrom.y * f0 + to.y * aFactor;
+		const float z = aFrom.z * f0 + to.z * aFactor;
+		const float w = aFrom.w * f0 + to.w * aFactor;
+		const float oneOverLength = 1.0f / std::sqrt(x * x + y * y + z * z + w * w);
+		return glm::quat{ w * oneOverLength, x * oneOverLength, y * oneOverLength, z * oneOverLength };
+	}
+
+	static void compose_affine_transform(const glm::vec3& aTranslation, const glm::quat& aRotation, const glm::vec3& aScale, glm::mat4& aResult)
+	{
+		const float xx = aRotation.x * aRotation.x, yy = aRotation.y * aRotation.y, zz = aRotation.z * aRotation.z;
+		const float xy = aRotation.x * aRotation.y, xz = aRotation.x * aRotation.z, yz = aRotation.y * aRotation.z;
+		const float wx = aRotation.w * aRotation.x, wy = aRotation.w * aRotation.y, wz = aRotation.w * aRotation.z;
+		aResult[0] = glm::vec4{ (1.0f - 2.0f * (yy + zz)) * aScale.x, (2.0f * (xy + wz)) * aScale.x, (2.0f * (xz - wy)) * aScale.x, 0.0f };
+		aResult[1] = glm::vec4{ (2.0f * (xy - wz)) * aScale.y, (1.0f - 2.0f * (xx + zz)) * aScale.y, (2.0f * (yz + wx)) * aScale.y, 0.0f };
+		aResult[2] = glm::vec4{ (2.0f * (xz + wy)) * aScale.z, (2.0f * (yz - wx)) * aScale.z, (1.0f - 2.0f * (xx + yy)) * aScale.z, 0.0f };
+		aResult[3] = glm::vec4{ aTranslation, 1.0f };
+	}
+
+#if defined(GVK_SSE2)
+	// Loads four quaternions and transposes them into one register per component
+	static void load_quaternions_transposed(const glm::quat* aSource, __m128& aX, __m128& aY, __m128& aZ, __m128& aW)
+	{
+		aX = _mm_loadu_ps(&aSource[0].x);
+		aY = _mm_loadu_ps(&aSource[1].x);
+		aZ = _mm_loadu_ps(&aSource[2].x);
+		aW = _mm_loadu_ps(&aSource[3].x);
+		_MM_TRANSPOSE4_PS(aX, aY, aZ, aW);
+	}
+
+	// Loads one component of four consecutive vec3s into one register
+	static __m128 load_component(const glm::vec3* aSource, int aComponent)
+	{
+		return _mm_setr_ps(aSource[0][aComponent], aSource[1][aComponent], aSource[2][aComponent], aSource[3][aComponent]);
+	}
+#endif
+
+	void blend_rotations(const glm::quat* aFrom, const glm::quat* aTo, float aFactor, glm::quat* aResult, size_t aCount)
+	{
+		size_t i = 0;
+#if defined(GVK_SSE2)
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+		const __m128 threshold = _mm_set1_ps(sNlerpThreshold);
+		const __m128 f0 = _mm_set1_ps(1.0f - aFactor);
+		const __m128 f1 = _mm_set1_ps(aFactor);
+		const __m128 one = _mm_set1_ps(1.0f);
+		for (; i + 4 <= aCount; i += 4) {
+			__m128 x1, y1, z1, w1, x2, y2, z2, w2;
+			load_quaternions_transposed(aFrom + i, x1, y1, z1, w1);
+			load_quaternions_transposed(aTo + i, x2, y2, z2, w2);
+
+			// Take the shortest path by flipping the target rotations' signs where the dot product is negative:
+			__m128 dot = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x1, x2), _mm_mul_ps(y1, y2)), _mm_mul_ps(z1, z2)), _mm_mul_ps(w1, w2));
+			const __m128 sign = _mm_and_ps(dot, signMask);
+			x2 = _mm_xor_ps(x2, sign);
+			y2 = _mm_xor_ps(y2, sign);
+			z2 = _mm_xor_ps(z2, sign);
+			w2 = _mm_xor_ps(w2, sign);
+			dot = _mm_xor_ps(dot, sign);
+
+			__m128 x = _mm_add_ps(_mm_mul_ps(x1, f0), _mm_mul_ps(x2, f1));
+			__m128 y = _mm_add_ps(_mm_mul_ps(y1, f0), _mm_mul_ps(y2, f1));
+			__m128 z = _mm_add_ps(_mm_mul_ps(z1, f0), _mm_mul_ps(z2, f1));
+			__m128 w = _mm_add_ps(_mm_mul_ps(w1, f0), _mm_mul_ps(w2, f1));
+			const __m128 oneOverLength = _mm_div_ps(one, _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)), _mm_mul_ps(w, w))));
+
+			// Rotations which are too far apart for a normalized linear interpolation are rare => handle them one by one.
+			// (Blend them before anything is stored, because aResult may be the same as aFrom or aTo.)
+			const int slerpLanes = _mm_movemask_ps(_mm_cmplt_ps(dot, threshold));
+			glm::quat slerped[4];
+			for (size_t lane = 0; lane < 4; ++lane) {
+				if (0 != (slerpLanes & (1 << lane))) {
+					slerped[lane] = glm::normalize(glm::slerp(aFrom[i + lane], aTo[i + lane], aFactor));
+				}
+			}
+
+			x = _mm_mul_ps(x, oneOverLength);
+			y = _mm_mul_ps(y, oneOverLength);
+			z = _mm_mul_ps(z, oneOverLength);
+			w = _mm_mul_ps(w, oneOverLength);
+			_MM_TRANSPOSE4_PS(x, y, z, w);
+			_mm_storeu_ps(&aResult[i + 0].x, x);
+			_mm_storeu_ps(&aResult[i + 1].x, y);
+			_mm_storeu_ps(&aResult[i + 2].x, z);
+			_mm_storeu_ps(&aResult[i + 3].x, w);
+			for (size_t lane = 0; lane < 4; ++lane) {
+				if (0 != (slerpLanes & (1 << lane))) {
+					aResult[i + lane] = slerped[lane];
+				}
+			}
+		}
+#endif
+		for (; i < aCount; ++i) {
+			aResult[i] = blend_rotation(aFrom[i], aTo[i], aFactor);
+		}
+	}
+
+	void lerp_vectors(const glm::vec3* aFrom, const glm::vec3* aTo, float aFactor, glm::vec3* aResult, size_t aCount)
+	{
+		// The vectors are tightly packed => process them as one array of floats:
+		static_assert(sizeof(glm::vec3) == 3 * sizeof(float));
+		const float* from = &aFrom[0].x;
+		const float* to = &aTo[0].x;
+		float* result = &aResult[0].x;
+		const size_t numFloats = 3 * aCount;
+		const float f0 = 1.0f - aFactor;
+
+		size_t i = 0;
+#if defined(GVK_SSE2)
+		const __m128 f0x4 = _mm_set1_ps(f0);
+		const __m128 f1x4 = _mm_set1_ps(aFactor);
+		for (; i + 4 <= numFloats; i += 4) {
+			_mm_storeu_ps(result + i, _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(from + i), f0x4), _mm_mul_ps(_mm_loadu_ps(to + i), f1x4)));
+		}
+#endif
+		for (; i < numFloats; ++i) {
+			result[i] = from[i] * f0 + to[i] * aFactor;
+		}
+	}
+
+	void compose_affine_transforms(const glm::vec3* aTranslations, const glm::quat* aRotations, const glm::vec3* aScales, glm::mat4* aResult, size_t aCount)
+	{
+		size_t i = 0;
+#if defined(GVK_SSE2)
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 one = _mm_set1_ps(1.0f);
+		const __m128 two = _mm_set1_ps(2.0f);
+		for (; i + 4 <= aCount; i += 4) {
+			__m128 x, y, z, w;
+			load_quaternions_transposed(aRotations + i, x, y, z, w);
+			const __m128 xx = _mm_mul_ps(x, x), yy = _mm_mul_ps(y, y), zz = _mm_mul_ps(z, z);
+			const __m128 xy = _mm_mul_ps(x, y), xz = _mm_mul_ps(x, z), yz = _mm_mul_ps(y, z);
+			const __m128 wx = _mm_mul_ps(w, x), wy = _mm_mul_ps(w, y), wz = _mm_mul_ps(w, z);
+			const __m128 sx = load_component(aScales + i, 0);
+			const __m128 sy = load_component(aScales + i, 1);
+			const __m128 sz = load_component(aScales + i, 2);
+
+			// One register per matrix element, each of which contains that element of all four matrices:
+			__m128 c0r0 = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(yy, zz))), sx);
+			__m128 c0r1 = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xy, wz)), sx);
+			__m128 c0r2 = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xz, wy)), sx);
+			__m128 c0r3 = zero;
+			__m128 c1r0 = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xy, wz)), sy);
+			__m128 c1r1 = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, zz))), sy);
+			__m128 c1r2 = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(yz, wx)), sy);
+			__m128 c1r3 = zero;
+			__m128 c2r0 = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xz, wy)), sz);
+			__m128 c2r1 = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(yz, wx)), sz);
+			__m128 c2r2 = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, yy))), sz);
+			__m128 c2r3 = zero;
+			__m128 c3r0 = load_component(aTranslations + i, 0);
+			__m128 c3r1 = load_component(aTranslations + i, 1);
+			__m128 c3r2 = load_component(aTranslations + i, 2);
+			__m128 c3r3 = one;
+
+			// Transpose them into one column per register, and write them out:
+			_MM_TRANSPOSE4_PS(c0r0, c0r1, c0r2, c0r3);
+			_MM_TRANSPOSE4_PS(c1r0, c1r1, c1r2, c1r3);
+			_MM_TRANSPOSE4_PS(c2r0, c2r1, c2r2, c2r3);
+			_MM_TRANSPOSE4_PS(c3r0, c3r1, c3r2, c3r3);
+			const __m128 columns[4][4] = { { c0r0, c1r0, c2r0, c3r0 }, { c0r1, c1r1, c2r1, c3r1 }, { c0r2, c1r2, c2r2, c3r2 }, { c0r3, c1r3, c2r3, c3r3 } };
+			for (size_t m = 0; m < 4; ++m) {
+				for (int c = 0; c < 4; ++c) {
+					_mm_storeu_ps(&aResult[i + m][c][0], columns[m][c]);
+				}
+			}
+		}
+#endif
+		for (; i < aCount; ++i) {
+			compose_affine_transform(aTranslations[i], aRotations[i], aScales[i], aResult[i]);
+		}
+	}
+}
@@ -0,0 +1,381 @@
+#include <gvk.hpp>
+
+namespace gvk
+{
+	// Half of the surface area of a box, which is all that the SAH needs, since only ratios of areas are relevant
+	static float half_surface_area(const aabb& aBox)
+	{
+		if (aBox.is_empty()) {
+			return 0.f;
+		}
+		const glm::vec3 d = aBox.mMax - aBox.mMin;
+		return d.x * d.y + d.y * d.z + d.z * d.x;
+	}
+
+	void bounding_volume_hierarchy::build_subtree(std::vector<node>& aNodes, uint32_t aRoot, std::span<const aabb> aBounds, std::span<const glm::vec3> aCentroids, std::vector<uint32_t>* aTasks)
+	{
+		// Costs of traversing an inner node and of testing a primitive, relative to each other:
+		constexpr float traversalCost = 1.f;
+		constexpr float primitiveCost = 1.f;
+
+		std::vector<uint32_t> stack{ aRoot };
+		while (!stack.empty()) {
+			const uint32_t nodeIndex = stack.back();
+			stack.pop_back();
+			const uint32_t first = aNodes[nodeIndex].mFirstPrimitive;
+			const uint32_t count = aNodes[nodeIndex].mNumPrimitives;
+			aNodes[nodeIndex].mFirstChild = sNoNode;
+			if (nullptr != aTasks && count <= sParallelTaskPrimitives) {
+				aTasks->push_back(nodeIndex);
+				continue;
+			}
+
+			aabb bounds;
+			aabb centroidBounds;
+			for (uint32_t i = first; i < first + count; ++i) {
+				const uint32_t primitive = mPrimitiveIndices[i];
+				bounds = merged(bounds, aBounds[primitive]);
+				centroidBounds.mMin = glm::min(centroidBounds.mMin, aCentroids[primitive]);
+				centroidBounds.mMax = glm::max(centroidBounds.mMax, aCentroids[primitive]);
+			}
+			aNodes[nodeIndex].mBounds = bounds;
+			if (count <= 1) {
+				continue;
+			}
+
+			// Evaluate the SAH for the boundaries between the bins along all axes where the centroids are spread.
+			// Small nodes do not need more bins than primitives, which saves most of the time for the lower levels:
+			const uint32_t numBins = std::min(count, sNumBins);
+			int bestAxis = -1;
+			uint32_t bestSplit = 0;
+			float bestCost = std::numeric_limits<float>::max();
+			for (int axis = 0; axis < 3; ++axis) {
+				const float extent = centroidBounds.mMax[axis] - centroidBounds.mMin[axis];
+				if (!(extent > 0.f)) {
+					continue;
+				}
+				const float scale = static_cast<float>(numBins) / extent;
+				std::array<aabb, sNumBins> binBounds;
+				std::array<uint32_t, sNumBins> binCounts{};
+				for (uint32_t i = first; i < first + count; ++i) {
+					const uint32_t primitive = mPrimitiveIndices[i];
+					const uint32_t bin = std::min(static_cast<uint32_t>((aCentroids[primitive][axis] - centroidBounds.mMin[axis]) * scale), numBins - 1);
+					binBounds[bin] = merged(binBounds[bin], aBounds[primitive]);
+					++binCounts[bin];
+				}
+				// Sweep from the right to get the costs of the right sides, then from the left to combine them:
+				std::array<float, sNumBins> rightCosts;
+				aabb right;
+				uint32_t rightCount = 0;
+				for (uint32_t split = numBins - 1; split > 0; --split) {
+					right = merged(right, binBounds[split]);
+					rightCount += binCounts[split];
+					rightCosts[split] = half_surface_area(right) * static_cast<float>(rightCount);
+				}
+				aabb left;
+				uint32_t leftCount = 0;
+				for (uint32_t split = 1; split < numBins; ++split) {
+					left = merged(left, binBounds[split - 1]);
+					leftCount += binCounts[split - 1];
+					if (0 == leftCount || count == leftCount) {
+						continue;
+					}
+					const float cost = half_surface_area(left) * static_cast<float>(leftCount) + rightCosts[split];
+					if (cost < bestCost) {
+						bestCost = cost;
+						bestAxis = axis;
+						bestSplit = split;
+					}
+				}
+			}
+
+			uint32_t leftCount;
+			if (bestAxis >= 0) {
+				const float area = half_surface_area(bounds);
+				const float splitCost = traversalCost + (area > 0.f ? bestCost / area : static_cast<float>(count)) * primitiveCost;
+				if (splitCost >= static_cast<float>(count) * primitiveCost && count <= sMaxLeafPrimitives) {
+					continue;
+				}
+				const float scale = static_cast<float>(numBins) / (centroidBounds.mMax[bestAxis] - centroidBounds.mMin[bestAxis]);
+				const auto middle = std::partition(mPrimitiveIndices.begin() + first, mPrimitiveIndices.begin() + first + count, [&](uint32_t primitive) {
+					return std::min(static_cast<uint32_t>((aCentroids[primitive][bestAxis] - centroidBounds.mMin[bestAxis]) * scale), numBins - 1) < bestSplit;
+				});
+				leftCount = static_cast<uint32_t>(middle - (mPrimitiveIndices.begin() + first));
+			}
+			else {
+				// All centroids are at the same position => the SAH can not distinguish them; split in the middle if too many:
+				if (count <= sMaxLeafPrimitives) {
+					continue;
+				}
+				leftCount = count / 2;
+			}
+
+			const auto firstChild = static_cast<uint32_t>(aNodes.size());
+			aNodes[nodeIndex].mFirstChild = firstChild;
+			aNodes.push_back(node{ aabb{}, sNoNode, first, leftCount });
+			aNodes.push_back(node{ aabb{}, sNoNode, first + leftCount, count - leftCount });
+			stack.push_back(firstChild + 1);
+			stack.push_back(firstChild);
+		}
+	}
+
+	void bounding_volume_hierarchy::build(std::span<const aabb> aBounds, uint32_t aMaxThreads)
+	{
+		const auto numPrimitives = static_cast<uint32_t>(aBounds.size());
+		mNodes.clear();
+		mPrimitiveIndices.resize(numPrimitives);
+		std::iota(mPrimitiveIndices.begin(), mPrimitiveIndices.end(), 0u);
+		mNeedsRefit = false;
+
+		std::vector<glm::vec3> centroids(numPrimitives);
+		for (uint32_t i = 0; i < numPrimitives; ++i) {
+			centroids[i] = aBounds[i].is_empty() ? glm::vec3{ 0.f } : aBounds[i].center();
+		}
+
+		// Build the upper part of the tree on this thread, down to subtrees which are small enough to be tasks...
+		mNodes.push_back(node{ aabb{}, sNoNode, 0u, numPrimitives });
+		std::vector<uint32_t> tasks;
+		build_subtree(mNodes, 0u, aBounds, centroids, &tasks);
+
+		// ...build all the tasks' subtrees in parallel, each into its own list of nodes, where its root is at index 0...
+		std::vector<std::vector<node>> taskNodes(tasks.size());
+		parallel_for(tasks.size(), [&](size_t aTask) {
+			auto& nodes = taskNodes[aTask];
+			nodes.push_back(mNodes[tasks[aTask]]);
+			build_subtree(nodes, 0u, aBounds, centroids, nullptr);
+		}, aMaxThreads);
+
+		// ...and append them to the upper part. The task's root replaces the placeholder node, all others are appended.
+		// Childs are still stored after their parents, which refit relies on:
+		for (size_t t = 0; t < tasks.size(); ++t) {
+			const auto& nodes = taskNodes[t];
+			const auto offset = static_cast<uint32_t>(mNodes.size()) - 1u;
+			const auto relocated = [offset](node aNode) {
+				if (!aNode.is_leaf()) {
+					aNode.mFirstChild += offset;
+				}
+				return aNode;
+			};
+			mNodes[tasks[t]] = relocated(nodes[0]);
+			for (size_t i = 1; i < nodes.size(); ++i) {
+				mNodes.push_back(relocated(nodes[i]));
+			}
+		}
+
+		mParentIndices.assign(mNodes.size(), sNoNode);
+		mOutdated.assign(mNodes.size(), 0);
+		mLeafIndices.resize(numPrimitives);
+		for (uint32_t i = 0; i < static_cast<uint32_t>(mNodes.size()); ++i) {
+			const auto& n = mNodes[i];
+			if (n.is_leaf()) {
+				std::fill(mLeafIndices.begin() + n.mFirstPrimitive, mLeafIndices.begin() + n.mFirstPrimitive + n.mNumPrimitives, i);
+			}
+			else {
+				mParentIndices[n.mFirstChild] = i;
+				mParentIndices[n.mFirstChild + 1] = i;
+			}
+		}
+
+		mOrderedBounds.resize(numPrimitives);
+		mPrimitiveSlots.resize(numPrimitives);
+		for (uint32_t slot = 0; slot < numPrimitives; ++slot) {
+			mOrderedBounds[slot] = aBounds[mPrimitiveIndices[slot]];
+			mPrimitiveSlots[mPrimitiveIndices[slot]] = slot;
+		}
+	}
+
+	void bounding_volume_hierarchy::set_primitive_bounds(uint32_t aPrimitive, const aabb& aBounds)
+	{
+		const uint32_t slot = mPrimitiveSlots[aPrimitive];
+		mOrderedBounds[slot] = aBounds;
+		// Mark the leaf and its ancestors; stop at the first one which is already marked, since all above are as well:
+		for (uint32_t n = mLeafIndices[slot]; sNoNode != n && 0 == mOutdated[n]; n = mParentIndices[n]) {
+			mOutdated[n] = 1;
+		}
+		mNeedsRefit = true;
+	}
+
+	void bounding_volume_hierarchy::refit()
+	{
+		if (!mNeedsRefit) {
+			return;
+		}
+		for (size_t i = mNodes.size(); i-- > 0;) {
+			if (0 == mOutdated[i]) {
+				continue;
+			}
+			auto& n = mNodes[i];
+			if (n.is_leaf()) {
+				n.mBounds = aabb{};
+				for (uint32_t slot = n.mFirstPrimitive; slot < n.mFirstPrimitive + n.mNumPrimitives; ++slot) {
+					n.mBounds = merged(n.mBounds, mOrderedBounds[slot]);
+				}
+			}
+			else {
+				n.mBounds = merged(mNodes[n.mFirstChild].mBounds, mNodes[n.mFirstChild + 1].mBounds);
+			}
+			mOutdated[i] = 0;
+		}
+		mNeedsRefit = false;
+	}
+
+	void bounding_volume_hierarchy::refit(std::span<const aabb> aBounds)
+	{
+		if (aBounds.size() != mPrimitiveIndices.size()) {
+			throw gvk::logic_error(fmt::format("The hierarchy has been built for {} primitives, but {} bounds have been passed to refit.", mPrimitiveIndices.size(), aBounds.size()));
+		}
+		for (size_t slot = 0; slot < mPrimitiveIndices.size(); ++slot) {
+			mOrderedBounds[slot] = aBounds[mPrimitiveIndices[slot]];
+		}
+		std::fill(mOutdated.begin(), mOutdated.end(), 1);
+		mNeedsRefit = true;
+		refit();
+	}
+
+	float bounding_volume_hierarchy::sah_cost() const
+	{
+		const float rootArea = mNodes.empty() ? 0.f : half_surface_area(mNodes[0].mBounds);
+		if (!(rootArea > 0.f)) {
+			return static_cast<float>(mPrimitiveIndices.size());
+		}
+		float cost = 0.f;
+		for (const auto& n : mNodes) {
+			cost += half_surface_area(n.mBounds) / rootArea * (n.is_leaf() ? static_cast<float>(n.mNumPrimitives) : 1.f);
+		}
+		return cost;
+	}
+
+	void bounding_volume_hierarchy::query_frustum(const frustum& aFrustum, std::vector<uint32_t>& aResult) const
+	{
+		aResult.clear();
+		if (mNodes.empty()) {
+			return;
+		}
+
+		// Each entry holds a node and a bit mask of the planes which it still has to be tested against. If a node
+		// is entirely on the inner side of a plane, so is its subtree, and the plane's bit is cleared for its childs.
+		constexpr uint32_t allPlanes = (1u << 6) - 1u;
+		std::vector<std::tuple<uint32_t, uint32_t>> stack{ { 0u, allPlanes } };
+		while (!stack.empty()) {
+			const auto [nodeIndex, planesToTest] = stack.back();
+			stack.pop_back();
+			const auto& n = mNodes[nodeIndex];
+			if (n.mBounds.is_empty()) {
+				continue;
+			}
+
+			const glm::vec3 center = n.mBounds.center();
+			const glm::vec3 extent = n.mBounds.extent();
+			uint32_t remainingPlanes = planesToTest;
+			bool outside = false;
+			for (uint32_t p = 0; p < 6; ++p) {
+				if (0 == (planesToTest & (1u << p))) {
+					continue;
+				}
+				const auto& plane = aFrustum.mPlanes[p];
+				const float distance = plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w;
+				const float radius = std::abs(plane.x) * extent.x + std::abs(plane.y) * extent.y + std::abs(plane.z) * extent.z;
+				if (distance < -radius) {
+					outside = true;
+					break;
+				}
+				if (distance >= radius) {
+					remainingPlanes &= ~(1u << p);
+				}
+			}
+			if (outside) {
+				continue;
+			}
+
+			if (0 == remainingPlanes) {
+				// Entirely inside => all of the subtree's primitives are visible, except for those with empty bounds:
+				for (uint32_t slot = n.mFirstPrimitive; slot < n.mFirstPrimitive + n.mNumPrimitives; ++slot) {
+					if (!mOrderedBounds[slot].is_empty()) {
+						aResult.push_back(mPrimitiveIndices[slot]);
+					}
+				}
+			}
+			else if (n.is_leaf()) {
+				for (uint32_t slot = n.mFirstPrimitive; slot < n.mFirstPrimitive + n.mNumPrimitives; ++slot) {
+					const auto& box = mOrderedBounds[slot];
+					if (!box.is_empty() && is_box_visible(aFrustum, box.mMin, box.mMax)) {
+						aResult.push_back(mPrimitiveIndices[slot]);
+					}
+				}
+			}
+			else {
+				stack.emplace_back(n.mFirstChild + 1, remainingPlanes);
+				stack.emplace_back(n.mFirstChild, remainingPlanes);
+			}
+		}
+	}
+
+	std::optional<bvh_hit> bounding_volume_hierarchy::nearest(const glm::vec3& aPoint, float aMaxDistance) const
+	{
+		std::optional<bvh_hit> result;
+		if (mNodes.empty()) {
+			return result;
+		}
+
+		// Squared distances from here on:
+		float closest = aMaxDistance < std::sqrt(std::numeric_limits<float>::max()) ? aMaxDistance * aMaxDistance : std::numeric_limits<float>::max();
+		std::vector<std::tuple<uint32_t, float>> stack{ { 0u, squared_distance_to_box(aPoint, mNodes[0].mBounds) } };
+		while (!stack.empty()) {
+			const auto [nodeIndex, nodeDistance] = stack.back();
+			stack.pop_back();
+			const auto& n = mNodes[nodeIndex];
+			if (nodeDistance > closest || n.mBounds.is_empty()) {
+				continue;
+			}
+			if (n.is_leaf()) {
+				for (uint32_t slot = n.mFirstPrimitive; slot < n.mFirstPrimitive + n.mNumPrimitives; ++slot) {
+					if (mOrderedBounds[slot].is_empty()) {
+						continue;
+					}
+					const float distance = squared_distance_to_box(aPoint, mOrderedBounds[slot]);
+					if (distance <= closest) {
+						closest = distance;
+						result = bvh_hit{ mPrimitiveIndices[slot], distance };
+					}
+				}
+				continue;
+			}
+			const float distances[2] = {
+				squared_distance_to_box(aPoint, mNodes[n.mFirstChild].mBounds),
+				squared_distance_to_box(aPoint, mNodes[n.mFirstChild + 1].mBounds)
+			};
+			// Push the farther child first, s.t. the nearer one is visited first:
+			const int nearer = distances[1] < distances[0] ? 1 : 0;
+			stack.emplace_back(n.mFirstChild + 1 - nearer, distances[1 - nearer]);
+			stack.emplace_back(n.mFirstChild + nearer, distances[nearer]);
+		}
+
+		if (result.has_value()) {
+			result->mDistance = std::sqrt(result->mDistance);
+		}
+		return result;
+	}
+
+	void orca_scene_bvh::build(const orca_scene_t& aScene, uint32_t aMaxThreads)
+	{
+		const auto& models = aScene.models();
+		mInstances.clear();
+		mFirstPrimitiveOfModel.resize(models.size());
+		mModelBounds.resize(models.size());
+		std::vector<aabb> bounds;
+		for (size_t m = 0; m < models.size(); ++m) {
+			mFirstPrimitiveOfModel[m] = static_cast<uint32_t>(mInstances.size());
+			mModelBounds[m] = aScene.bounds_of_model(m).mBox;
+			for (size_t i = 0; i < models[m].mInstances.size(); ++i) {
+				mInstances.push_back(orca_instance_index{ static_cast<uint32_t>(m), static_cast<uint32_t>(i) });
+				bounds.push_back(bounds_of_instance(mModelBounds[m], models[m].mInstances[i]));
+			}
+		}
+		mBvh.build(bounds, aMaxThreads);
+	}
+
+	void orca_scene_bvh::update_instance(const orca_scene_t& aScene, size_t aModelIndex, size_t aInstanceIndex)
+	{
+		mBvh.set_primitive_bounds(primitive(aModelIndex, aInstanceIndex), bounds_of_instance(mModelBounds[aModelIndex], aScene.model_at_index(aModelIndex).mInstances[aInstanceIndex]));
+	}
+}
@@ -0,0 +1,134 @@
+#include <gvk.hpp>
+
+namespace gvk
+{
+	// Spheres and oriented boxes are computed in multiple steps, each of which rounds. They are enlarged by
+	// this factor, s.t. they contain all of the points for sure:
+	static constexpr float sRoundingCompensation = 1.0f + 1e-5f;
+
+	aabb bounding_box_of_points(std::span<const glm::vec3> aPoints)
+	{
+		aabb result;
+		for (const auto& p : aPoints) {
+			result.mMin = glm::min(result.mMin, p);
+			result.mMax = glm::max(result.mMax, p);
+		}
+		return result;
+	}
+
+	// Returns the point which is farthest away from aFrom
+	static const glm::vec3& farthest_point(std::span<const glm::vec3> aPoints, const glm::vec3& aFrom)
+	{
+		size_t farthest = 0;
+		float maxDistance2 = -1.f;
+		for (size_t i = 0; i < aPoints.size(); ++i) {
+			const float distance2 = glm::dot(aPoints[i] - aFrom, aPoints[i] - aFrom);
+			if (distance2 > maxDistance2) {
+				maxDistance2 = distance2;
+				farthest = i;
+			}
+		}
+		return aPoints[farthest];
+	}
+
+	bounding_sphere bounding_sphere_of_points(std::span<const glm::vec3> aPoints)
+	{
+		if (aPoints.empty()) {
+			return bounding_sphere{};
+		}
+
+		// Ritter's algorithm: start with a sphere around two points which are far apart from each other...
+		const glm::vec3 a = farthest_point(aPoints, aPoints[0]);
+		const glm::vec3 b = farthest_point(aPoints, a);
+		bounding_sphere ritter{ (a + b) * 0.5f, glm::length(b - a) * 0.5f };
+		// ...and grow it s.t. it contains all the points which are still outside:
+		for (const auto& p : aPoints) {
+			const float distance = glm::length(p - ritter.mCenter);
+			if (distance > ritter.mRadius) {
+				const float radius = (ritter.mRadius + distance) * 0.5f;
+				ritter.mCenter += (p - ritter.mCenter) * ((radius - ritter.mRadius) / distance);
+				ritter.mRadius = radius;
+			}
+		}
+
+		// For box-like point sets, the sphere around the bounding box' center can be tighter:
+		bounding_sphere boxCentered{ bounding_box_of_points(aPoints).center(), 0.f };
+		for (const auto& p : aPoints) {
+			boxCentered.mRadius = std::max(boxCentered.mRadius, glm::length(p - boxCentered.mCenter));
+		}
+		auto result = boxCentered.mRadius < ritter.mRadius ? boxCentered : ritter;
+		result.mRadius *= sRoundingCompensation;
+		return result;
+	}
+
+	// Computes the eigenvectors of a symmetric 3x3 matrix with the cyclic Jacobi method; they are returned as the columns of the result
+	static glm::mat3 eigenvectors_of_symmetric(glm::mat3 aMatrix)
+	{
+		glm::mat3 eigenvectors{ 1.f };
+		for (int sweep = 0; sweep < 32; ++sweep) {
+			const float offDiagonal = aMatrix[1][0] * aMatrix[1][0] + aMatrix[2][0] * aMatrix[2][0] + aMatrix[2][1] * aMatrix[2][1];
+			if (offDiagonal < 1e-12f * (aMatrix[0][0] * aMatrix[0][0] + aMatrix[1][1] * aMatrix[1][1] + aMatrix[2][2] * aMatrix[2][2]) || offDiagonal == 0.f) {
+				break;
+			}
+			for (int p = 0; p < 2; ++p) {
+				for (int q = p + 1; q < 3; ++q) {
+					if (aMatrix[q][p] == 0.f) {
+						continue;
+					}
+					// Rotate in the (p, q) plane s.t. the element (p, q) becomes zero:
+					const float theta = (aMatrix[q][q] - aMatrix[p][p]) / (2.f * aMatrix[q][p]);
+					const float t = (theta >= 0.f ? 1.f : -1.f) / (std::abs(theta) + std::sqrt(theta * theta + 1.f));
+					const float c = 1.f / std::sqrt(t * t + 1.f);
+					const float s = t * c;
+					glm::mat3 rotation{ 1.f };
+					rotation[p][p] = c;
+					rotation[q][q] = c;
+					rotation[q][p] = s;
+					rotation[p][q] = -s;
+					aMatrix = glm::transpose(rotation) * aMatrix * rotation;
+					eigenvectors = eigenvectors * rotation;
+				}
+			}
+		}
+		return eigenvectors;
+	}
+
+	oriented_bounding_box oriented_bounding_box_of_points(std::span<const glm::vec3> aPoints)
+	{
+		if (aPoints.empty()) {
+			return oriented_bounding_box{};
+		}
+
+		// Principal components of the points:
+		glm::vec3 mean{ 0.f };
+		for (const auto& p : aPoints) {
+			mean += p;
+		}
+		mean /= static_cast<float>(aPoints.size());
+		glm::mat3 covariance{ 0.f };
+		for (const auto& p : aPoints) {
+			const glm::vec3 d = p - mean;
+			covariance += glm::outerProduct(d, d);
+		}
+		glm::mat3 axes = eigenvectors_of_symmetric(covariance / static_cast<float>(aPoints.size()));
+		axes[2] = glm::cross(axes[0], axes[1]); // Make sure that it is right-handed
+
+		// Extent along the axes:
+		glm::vec3 minProjection{ std::numeric_limits<float>::max() };
+		glm::vec3 maxProjection{ -std::numeric_limits<float>::max() };
+		const glm::mat3 toAxes = glm::transpose(axes);
+		for (const auto& p : aPoints) {
+			const glm::vec3 projection = toAxes * (p - mean);
+			minProjection = glm::min(minProjection, projection);
+			maxProjection = glm::max(maxProjection, projection);
+		}
+		oriented_bounding_box result{ mean + axes * ((minProjection + maxProjection) * 0.5f), axes, (maxProjection - minProjection) * 0.5f * sRoundingCompensation };
+
+		const auto box = bounding_box_of_points(aPoints);
+		const glm::vec3 boxExtent = box.extent();
+		if (boxExtent.x * boxExtent.y * boxExtent.z <= result.mHalfExtents.x * result.mHalfExtents.y * result.mHalfExtents.z) {
+			return oriented_bounding_box{ box.center(), glm::mat3{ 1.f }, boxExtent };
+		}
+		return result;
+	}
+}
@@ -150,6 +150,11 @@ namespace gvk
 		return projection_matrix() * view_matrix();
 	}
 
+	frustum camera::view_frustum() const
+	{
+		return frustum_from_matrix(projection_and_view_matrix());
+	}
+
 	void camera::update_projection_matrix()
 	{
 		static const glm::mat4 sInverseRotateAroundXFrom_RH_Yup_to_RH_Ydown = []() {
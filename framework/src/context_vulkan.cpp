@@ -45,6 +45,8 @@ namespace gvk
 
 		mLogicalDevice.waitIdle();
 
+		mUploadStagingRing.cleanup();
+
 #if defined(AVK_USE_VMA)
 		vmaDestroyAllocator(mMemoryAllocator);
 #endif
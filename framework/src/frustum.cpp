@@ -0,0 +1,100 @@
+#include <gvk.hpp>
+
+namespace gvk
+{
+	frustum frustum_from_matrix(const glm::mat4& aProjectionAndViewMatrix)
+	{
+		// A point is inside if -w <= x <= w, -w <= y <= w, and 0 <= z <= w in clip space. Each of these
+		// conditions is a plane equation in terms of the matrix' rows (Gribb and Hartmann):
+		const auto row = [&aProjectionAndViewMatrix](int aRow) {
+			return glm::vec4{ aProjectionAndViewMatrix[0][aRow], aProjectionAndViewMatrix[1][aRow], aProjectionAndViewMatrix[2][aRow], aProjectionAndViewMatrix[3][aRow] };
+		};
+		frustum result;
+		result.mPlanes[frustum::left_plane]   = row(3) + row(0);
+		result.mPlanes[frustum::right_plane]  = row(3) - row(0);
+		result.mPlanes[frustum::bottom_plane] = row(3) + row(1);
+		result.mPlanes[frustum::top_plane]    = row(3) - row(1);
+		result.mPlanes[frustum::near_plane]   = row(2);
+		result.mPlanes[frustum::far_plane]    = row(3) - row(2);
+		for (auto& plane : result.mPlanes) {
+			plane /= glm::length(glm::vec3{ plane });
+		}
+		return result;
+	}
+
+	void cull_spheres(const frustum& aFrustum, const bounding_spheres_soa& aSpheres, std::vector<uint32_t>& aVisibleIndices)
+	{
+		const size_t count = aSpheres.mCenterX.size();
+		if (aSpheres.mCenterY.size() != count || aSpheres.mCenterZ.size() != count || aSpheres.mRadius.size() != count) {
+			throw gvk::logic_error("All arrays of bounding_spheres_soa must have the same size.");
+		}
+		aVisibleIndices.clear();
+		aVisibleIndices.reserve(count);
+
+		size_t i = 0;
+#if defined(GVK_SSE2)
+		for (; i + 4 <= count; i += 4) {
+			const __m128 cx = _mm_loadu_ps(&aSpheres.mCenterX[i]);
+			const __m128 cy = _mm_loadu_ps(&aSpheres.mCenterY[i]);
+			const __m128 cz = _mm_loadu_ps(&aSpheres.mCenterZ[i]);
+			const __m128 negRadius = _mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(&aSpheres.mRadius[i]));
+			__m128 outside = _mm_setzero_ps();
+			for (const auto& plane : aFrustum.mPlanes) {
+				const __m128 distance = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane.x), cx), _mm_mul_ps(_mm_set1_ps(plane.y), cy)), _mm_mul_ps(_mm_set1_ps(plane.z), cz)), _mm_set1_ps(plane.w));
+				outside = _mm_or_ps(outside, _mm_cmplt_ps(distance, negRadius));
+			}
+			const int visibleLanes = ~_mm_movemask_ps(outside) & 0xF;
+			for (uint32_t lane = 0; lane < 4; ++lane) {
+				if (0 != (visibleLanes & (1 << lane))) {
+					aVisibleIndices.push_back(static_cast<uint32_t>(i) + lane);
+				}
+			}
+		}
+#endif
+		for (; i < count; ++i) {
+			if (is_sphere_visible(aFrustum, glm::vec3{ aSpheres.mCenterX[i], aSpheres.mCenterY[i], aSpheres.mCenterZ[i] }, aSpheres.mRadius[i])) {
+				aVisibleIndices.push_back(static_cast<uint32_t>(i));
+			}
+		}
+	}
+
+	void cull_boxes(const frustum& aFrustum, const bounding_boxes_soa& aBoxes, std::vector<uint32_t>& aVisibleIndices)
+	{
+		const size_t count = aBoxes.mMinX.size();
+		if (aBoxes.mMinY.size() != count || aBoxes.mMinZ.size() != count || aBoxes.mMaxX.size() != count || aBoxes.mMaxY.size() != count || aBoxes.mMaxZ.size() != count) {
+			throw gvk::logic_error("All arrays of bounding_boxes_soa must have the same size.");
+		}
+		aVisibleIndices.clear();
+		aVisibleIndices.reserve(count);
+
+		size_t i = 0;
+#if defined(GVK_SSE2)
+		const __m128 half = _mm_set1_ps(0.5f);
+		for (; i + 4 <= count; i += 4) {
+			const __m128 minX = _mm_loadu_ps(&aBoxes.mMinX[i]), maxX = _mm_loadu_ps(&aBoxes.mMaxX[i]);
+			const __m128 minY = _mm_loadu_ps(&aBoxes.mMinY[i]), maxY = _mm_loadu_ps(&aBoxes.mMaxY[i]);
+			const __m128 minZ = _mm_loadu_ps(&aBoxes.mMinZ[i]), maxZ = _mm_loadu_ps(&aBoxes.mMaxZ[i]);
+			const __m128 cx = _mm_mul_ps(_mm_add_ps(minX, maxX), half), ex = _mm_mul_ps(_mm_sub_ps(maxX, minX), half);
+			const __m128 cy = _mm_mul_ps(_mm_add_ps(minY, maxY), half), ey = _mm_mul_ps(_mm_sub_ps(maxY, minY), half);
+			const __m128 cz = _mm_mul_ps(_mm_add_ps(minZ, maxZ), half), ez = _mm_mul_ps(_mm_sub_ps(maxZ, minZ), half);
+			__m128 outside = _mm_setzero_ps();
+			for (const auto& plane : aFrustum.mPlanes) {
+				const __m128 distance = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane.x), cx), _mm_mul_ps(_mm_set1_ps(plane.y), cy)), _mm_mul_ps(_mm_set1_ps(plane.z), cz)), _mm_set1_ps(plane.w));
+				const __m128 radius = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(std::abs(plane.x)), ex), _mm_mul_ps(_mm_set1_ps(std::abs(plane.y)), ey)), _mm_mul_ps(_mm_set1_ps(std::abs(plane.z)), ez));
+				outside = _mm_or_ps(outside, _mm_cmplt_ps(distance, _mm_sub_ps(_mm_setzero_ps(), radius)));
+			}
+			const int visibleLanes = ~_mm_movemask_ps(outside) & 0xF;
+			for (uint32_t lane = 0; lane < 4; ++lane) {
+				if (0 != (visibleLanes & (1 << lane))) {
+					aVisibleIndices.push_back(static_cast<uint32_t>(i) + lane);
+				}
+			}
+		}
+#endif
+		for (; i < count; ++i) {
+			if (is_box_visible(aFrustum, glm::vec3{ aBoxes.mMinX[i], aBoxes.mMinY[i], aBoxes.mMinZ[i] }, glm::vec3{ aBoxes.mMaxX[i], aBoxes.mMaxY[i], aBoxes.mMaxZ[i] })) {
+				aVisibleIndices.push_back(static_cast<uint32_t>(i));
+			}
+		}
+	}
+}
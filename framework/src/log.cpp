@@ -271,6 +271,9 @@ namespace gvk
 #else
 	void dispatch_log(log_pack pToBeLogged)
 	{
+		// Log messages can be dispatched from worker threads (e.g. during parallel loading) => don't interleave them
+		static std::mutex sLogMutex;
+		std::scoped_lock<std::mutex> guard(sLogMutex);
 		gvk::set_console_output_color(pToBeLogged.mLogType, pToBeLogged.mLogImportance);
 		std::cout << pToBeLogged.mMessage;
 #if defined(_WIN32) && defined (_DEBUG) && defined (PRINT_STACKTRACE)
@@ -10,8 +10,18 @@ namespace gvk
 		avk::filter_mode aTextureFilterMode,
 		avk::border_handling_mode aBorderHandlingMode,
 		avk::sync aSyncHandler,
+		bool aCompressTextures,
 		std::optional<std::reference_wrapper<gvk::serializer>> aSerializer = {})
 	{
+		if (aSerializer) {
+			if (aSerializer->get().mode() == serializer::mode::serialize) {
+				aSerializer->get().set_compress_textures(aCompressTextures);
+			}
+			else if (aSerializer->get().compress_textures().value_or(aCompressTextures) != aCompressTextures) {
+				throw gvk::runtime_error(fmt::format("The textures in the cache file have {}been compressed, but aCompressTextures is {}. Pass aCompressTextures also to the serializer's constructor, s.t. the cache file is rebuilt when it changes.", aCompressTextures ? "not " : "", aCompressTextures));
+			}
+		}
+
 		// These are the texture names loaded from file -> mapped to vector of usage-pointers
 		std::unordered_map<std::string, std::vector<int*>> texNamesToUsages;
 		// Textures contained in this array shall be loaded into an sRGB format
@@ -245,24 +255,45 @@ namespace gvk
 		// Load all the images from file, and assign them to all usages
 		if (!aSerializer ||
 			(aSerializer && (aSerializer->get().mode() == serializer::mode::serialize))) {
-			// create_image_from_file_cached takes the serializer as an optional,
-			// therefore the call is safe with and without one
+			std::vector<const std::pair<const std::string, std::vector<int*>>*> texFiles;
+			texFiles.reserve(texNamesToUsages.size());
 			for (auto& pair : texNamesToUsages) {
 				assert(!pair.first.empty());
+				texFiles.push_back(&pair);
+			}
 
-				bool potentiallySrgb = srgbTextures.contains(pair.first);
-
-				imageSamplers.push_back(
-					context().create_image_sampler(
-						owned(context().create_image_view(
-							create_image_from_file_cached(pair.first, true, potentiallySrgb, aFlipTextures, 4, avk::memory_usage::device, aImageUsage, getSync(), aSerializer)
-						)),
-						owned(context().create_sampler(aTextureFilterMode, aBorderHandlingMode))
-					)
-				);
-				int index = static_cast<int>(imageSamplers.size() - 1);
-				for (auto* img : pair.second) {
-					*img = index;
+			// Decoding the image files is by far the most expensive part => do it on multiple threads.
+			// Only the uploads below must happen on this thread, in a deterministic order (for the serializer).
+			// The images are decoded and uploaded in batches of one image per worker thread, s.t. at most one
+			// batch of decoded images is held in host memory at any time, regardless of the number of textures.
+			const size_t batchSize = std::max<size_t>(1, max_worker_threads());
+			std::vector<loaded_image_file> loadedImages(std::min(batchSize, texFiles.size()));
+			for (size_t batchBegin = 0; batchBegin < texFiles.size(); batchBegin += batchSize) {
+				const size_t batchCount = std::min(batchSize, texFiles.size() - batchBegin);
+				parallel_for(batchCount, [&](size_t i) {
+					const auto& path = texFiles[batchBegin + i]->first;
+					loadedImages[i] = load_image_file(path, true, srgbTextures.contains(path), aFlipTextures, 4, aCompressTextures);
+				});
+
+				// create_image_from_file_cached takes the serializer as an optional,
+				// therefore the call is safe with and without one
+				for (size_t i = 0; i < batchCount; ++i) {
+					const auto& pair = *texFiles[batchBegin + i];
+					bool potentiallySrgb = srgbTextures.contains(pair.first);
+
+					imageSamplers.push_back(
+						context().create_image_sampler(
+							owned(context().create_image_view(
+								create_image_from_file_cached(pair.first, true, potentiallySrgb, aFlipTextures, 4, avk::memory_usage::device, aImageUsage, getSync(), aSerializer, std::move(loadedImages[i]))
+							)),
+							owned(context().create_sampler(aTextureFilterMode, aBorderHandlingMode))
+						)
+					);
+					loadedImages[i] = {}; // Free the CPU-side copy as soon as it has been uploaded
+					int index = static_cast<int>(imageSamplers.size() - 1);
+					for (auto* img : pair.second) {
+						*img = index;
+					}
 				}
 			}
 		}
@@ -301,7 +332,8 @@ namespace gvk
 		avk::image_usage aImageUsage,
 		avk::filter_mode aTextureFilterMode, 
 		avk::border_handling_mode aBorderHandlingMode,
-		avk::sync aSyncHandler)
+		avk::sync aSyncHandler,
+		bool aCompressTextures)
 	{
 		return convert_for_gpu_usage_cached(
 			aMaterialConfigs,
@@ -310,7 +342,8 @@ namespace gvk
 			aImageUsage,
 			aTextureFilterMode,
 			aBorderHandlingMode,
-			std::move(aSyncHandler));
+			std::move(aSyncHandler),
+			aCompressTextures);
 	}
 
 	std::tuple<std::vector<material_gpu_data>, std::vector<avk::image_sampler>> convert_for_gpu_usage_cached(
@@ -321,7 +354,8 @@ namespace gvk
 		avk::image_usage aImageUsage,
 		avk::filter_mode aTextureFilterMode,
 		avk::border_handling_mode aBorderHandlingMode,
-		avk::sync aSyncHandler)
+		avk::sync aSyncHandler,
+		bool aCompressTextures)
 	{
 		return convert_for_gpu_usage_cached(
 			aMaterialConfigs,
@@ -331,54 +365,224 @@ namespace gvk
 			aTextureFilterMode,
 			aBorderHandlingMode,
 			std::move(aSyncHandler),
+			aCompressTextures,
 			aSerializer);
 	}
 
-	static inline void fill_device_buffer_cached(gvk::serializer& aSerializer, avk::buffer& aDeviceBuffer, size_t aTotalSize, avk::sync& aSyncHandler)
+	loaded_image_file generate_mip_maps_and_compress(const gli::texture& aImage, bool aSrgb)
 	{
-		// Create host visible staging buffer for filling on host side from file
-		auto sb = context().create_buffer(
-			AVK_STAGING_BUFFER_MEMORY_USAGE,
-			vk::BufferUsageFlagBits::eTransferSrc,
-			avk::generic_buffer_meta::create_from_size(aTotalSize)
-		);
-		// Let the serializer map and fill the buffer
-		aSerializer.archive_buffer(sb);
+		const int numComponents = static_cast<int>(gli::component_count(aImage.format()));
+		if (gli::is_compressed(aImage.format()) || gli::block_size(aImage.format()) != static_cast<size_t>(numComponents)) {
+			throw gvk::runtime_error("generate_mip_maps_and_compress only supports uncompressed images with 8 bits per component.");
+		}
+
+		const glm::ivec2 extent{ aImage.extent()[0], aImage.extent()[1] };
+		const auto* firstLevel = static_cast<const uint8_t*>(aImage.data(0, 0, 0));
+		std::vector<uint8_t> levelData(firstLevel, firstLevel + static_cast<size_t>(extent.x) * static_cast<size_t>(extent.y) * static_cast<size_t>(numComponents));
+
+		// Fully opaque RGBA images do not need the extra alpha block of BC3:
+		bool storeAlpha = 4 == numComponents;
+		if (storeAlpha) {
+			storeAlpha = false;
+			for (size_t i = 3; i < levelData.size(); i += 4) {
+				if (levelData[i] != 255) {
+					storeAlpha = true;
+					break;
+				}
+			}
+		}
+
+		gli::format gliFormat;
+		vk::Format vkFormat;
+		switch (numComponents) {
+		case 1:
+			gliFormat = gli::FORMAT_R_ATI1N_UNORM_BLOCK8;
+			vkFormat = vk::Format::eBc4UnormBlock;
+			break;
+		case 2:
+			gliFormat = gli::FORMAT_RG_ATI2N_UNORM_BLOCK16;
+			vkFormat = vk::Format::eBc5UnormBlock;
+			break;
+		default:
+			if (storeAlpha) {
+				gliFormat = aSrgb ? gli::FORMAT_RGBA_DXT5_SRGB_BLOCK16 : gli::FORMAT_RGBA_DXT5_UNORM_BLOCK16;
+				vkFormat = aSrgb ? vk::Format::eBc3SrgbBlock : vk::Format::eBc3UnormBlock;
+			}
+			else {
+				gliFormat = aSrgb ? gli::FORMAT_RGB_DXT1_SRGB_BLOCK8 : gli::FORMAT_RGB_DXT1_UNORM_BLOCK8;
+				vkFormat = aSrgb ? vk::Format::eBc1RgbSrgbBlock : vk::Format::eBc1RgbUnormBlock;
+			}
+			break;
+		}
+
+		const auto numLevels = gli::levels(gli::extent2d{ extent });
+		gli::texture2d result(gliFormat, gli::extent2d{ extent }, numLevels);
+		const auto blockSize = gli::block_size(gliFormat);
+
+		glm::ivec2 levelExtent = extent;
+		for (size_t level = 0; level < numLevels; ++level) {
+			if (level > 0) {
+				// Downsample the previous level:
+				const glm::ivec2 nextExtent = glm::max(levelExtent / 2, glm::ivec2{ 1 });
+				std::vector<uint8_t> nextData(static_cast<size_t>(nextExtent.x) * static_cast<size_t>(nextExtent.y) * static_cast<size_t>(numComponents));
+				int success;
+				if (aSrgb && numComponents >= 3) {
+					success = stbir_resize_uint8_srgb(levelData.data(), levelExtent.x, levelExtent.y, 0, nextData.data(), nextExtent.x, nextExtent.y, 0, numComponents, 4 == numComponents ? 3 : STBIR_ALPHA_CHANNEL_NONE, 0);
+				}
+				else {
+					success = stbir_resize_uint8(levelData.data(), levelExtent.x, levelExtent.y, 0, nextData.data(), nextExtent.x, nextExtent.y, 0, numComponents);
+				}
+				if (!success) {
+					throw gvk::runtime_error(fmt::format("Couldn't generate MIP level {} using stbir_resize", level));
+				}
+				levelData = std::move(nextData);
+				levelExtent = nextExtent;
+			}
+
+			// Compress the level block by block. Blocks at the borders are padded by repeating the last texel.
+			auto* dst = static_cast<uint8_t*>(result.data(0, 0, level));
+			std::array<uint8_t, 16 * 4> block;
+			const int srcTexelsPerBlockTexel = numComponents <= 2 ? numComponents : 4;
+			for (int by = 0; by < levelExtent.y; by += 4) {
+				for (int bx = 0; bx < levelExtent.x; bx += 4) {
+					for (int y = 0; y < 4; ++y) {
+						for (int x = 0; x < 4; ++x) {
+							const int px = std::min(bx + x, levelExtent.x - 1);
+							const int py = std::min(by + y, levelExtent.y - 1);
+							const auto* texel = &levelData[(static_cast<size_t>(py) * levelExtent.x + px) * numComponents];
+							auto* blockTexel = &block[static_cast<size_t>(y * 4 + x) * srcTexelsPerBlockTexel];
+							for (int c = 0; c < srcTexelsPerBlockTexel; ++c) {
+								blockTexel[c] = c < numComponents ? texel[c] : 255;
+							}
+						}
+					}
+
+					switch (numComponents) {
+					case 1:
+						stb_compress_bc4_block(dst, block.data());
+						break;
+					case 2:
+						stb_compress_bc5_block(dst, block.data());
+						break;
+					default:
+						stb_compress_dxt_block(dst, block.data(), storeAlpha ? 1 : 0, STB_DXT_HIGHQUAL);
+						break;
+					}
+					dst += blockSize;
+				}
+			}
+		}
+
+		return loaded_image_file{ vkFormat, std::move(result) };
+	}
+
+	// Copies aSize bytes from aData into a staging ring allocation and records a copy from there into
+	// aDeviceBuffer. Neither barriers are established, nor is the command buffer submitted.
+	static inline void record_staged_upload(const void* aData, size_t aSize, avk::buffer& aDeviceBuffer, avk::sync& aSyncHandler)
+	{
+		auto staging = context().upload_staging_ring().allocate(aSize);
+		staging.fill(aData, aSize);
 
 		auto& commandBuffer = aSyncHandler.get_or_create_command_buffer();
+		avk::copy_buffer_to_another(avk::referenced(staging.buffer()), avk::referenced(aDeviceBuffer), staging.offset(), 0, aSize, avk::sync::with_barriers_into_existing_command_buffer(commandBuffer, {}, {}));
+
+		// The allocation goes back to the staging ring once the command buffer is done:
+		commandBuffer.set_custom_deleter([lStaging = std::move(staging)](){});
+	}
+
+	static inline void fill_device_buffer(avk::buffer& aDeviceBuffer, const void* aData, size_t aSize, avk::sync& aSyncHandler)
+	{
+		aSyncHandler.get_or_create_command_buffer();
 		// Sync before
 		aSyncHandler.establish_barrier_before_the_operation(avk::pipeline_stage::transfer, avk::read_memory_access{ avk::memory_access::transfer_read_access });
 
-		// Copy host visible staging buffer to device buffer
-		avk::copy_buffer_to_another(avk::referenced(sb), avk::referenced(aDeviceBuffer), 0, 0, aTotalSize, avk::sync::with_barriers_into_existing_command_buffer(commandBuffer, {}, {}));
+		// Copy via the staging ring to the device buffer
+		record_staged_upload(aData, aSize, aDeviceBuffer, aSyncHandler);
 
 		// Sync after
 		aSyncHandler.establish_barrier_after_the_operation(avk::pipeline_stage::transfer, avk::write_memory_access{ avk::memory_access::transfer_write_access });
 
-		// Take care of the lifetime handling of the stagingBuffer, it might still be in use
-		commandBuffer.set_custom_deleter([
-			lOwnedStagingBuffer{ std::move(sb) }
-		]() { /* Nothing to do here, the buffers' destructors will do the cleanup, the lambda is just storing it. */ });
-
 		// Finish him
 		aSyncHandler.submit_and_sync();
 	}
 
-	std::tuple<std::vector<glm::vec3>, std::vector<uint32_t>> get_vertices_and_indices(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes)
+	static inline void fill_device_buffer_cached(gvk::serializer& aSerializer, avk::buffer& aDeviceBuffer, size_t aTotalSize, avk::sync& aSyncHandler)
 	{
-		std::vector<glm::vec3> positionsData;
-		std::vector<uint32_t> indicesData;
+		// The data is copied straight from the memory-mapped cache file into the staging ring
+		auto data = aSerializer.archive_span(std::span<const uint8_t>{});
+		if (data.size() != aTotalSize) {
+			throw gvk::runtime_error(fmt::format("Expected {} bytes of buffer data in the cache file, but found {} bytes.", aTotalSize, data.size()));
+		}
+		fill_device_buffer(aDeviceBuffer, data.data(), aTotalSize, aSyncHandler);
+	}
+
+	/** Gathers per-vertex data of all the selected meshes into one contiguous vector.
+	 *	The meshes are processed in parallel by `parallel_for`, but the result is ordered exactly
+	 *	as if the meshes had been processed one after the other, in the order of the selection.
+	 *	@param	aGetter		Function with the signature std::vector<T>(const gvk::model_t&, mesh_index_t),
+	 *						which returns `number_of_vertices_for_mesh` elements for the given mesh.
+	 */
+	template <typename T, typename F>
+	static std::vector<T> gather_vertex_data_of_meshes(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, F aGetter)
+	{
+		struct mesh_to_gather
+		{
+			const gvk::model_t* mModel;
+			mesh_index_t mMeshIndex;
+			size_t mVertexOffset;
+		};
+		std::vector<mesh_to_gather> meshes;
+		size_t numVertices = 0;
+		for (auto& pair : aModelsAndSelectedMeshes) {
+			const auto& modelRef = std::get<avk::resource_reference<const gvk::model_t>>(pair);
+			for (auto meshIndex : std::get<std::vector<mesh_index_t>>(pair)) {
+				meshes.push_back({ &modelRef.get(), meshIndex, numVertices });
+				numVertices += modelRef.get().number_of_vertices_for_mesh(meshIndex);
+			}
+		}
+
+		std::vector<T> result(numVertices);
+		parallel_for(meshes.size(), [&](size_t i) {
+			const auto& mesh = meshes[i];
+			auto meshData = aGetter(*mesh.mModel, mesh.mMeshIndex);
+			assert(meshData.size() == mesh.mModel->number_of_vertices_for_mesh(mesh.mMeshIndex));
+			std::copy(std::begin(meshData), std::end(meshData), std::begin(result) + mesh.mVertexOffset);
+		});
+		return result;
+	}
 
+	std::tuple<std::vector<glm::vec3>, std::vector<uint32_t>> get_vertices_and_indices(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes)
+	{
+		// Determine the total sizes and each mesh's offsets first, s.t. all the meshes can be written
+		// in parallel, directly to their final place, without intermediate vectors:
+		struct mesh_to_gather
+		{
+			const gvk::model_t* mModel;
+			mesh_index_t mMeshIndex;
+			size_t mVertexOffset;
+			size_t mIndexOffset;
+		};
+		std::vector<mesh_to_gather> meshes;
+		size_t numPositions = 0;
+		size_t numIndices = 0;
 		for (auto& pair : aModelsAndSelectedMeshes) {
 			const auto& modelRef = std::get<avk::resource_reference<const gvk::model_t>>(pair);
 			for (auto meshIndex : std::get<std::vector<mesh_index_t>>(pair)) {
-				gvk::append_indices_and_vertex_data(
-					gvk::additional_index_data(	indicesData,	[&]() { return modelRef.get().indices_for_mesh<uint32_t>(meshIndex);	} ),
-					gvk::additional_vertex_data(positionsData,	[&]() { return modelRef.get().positions_for_mesh(meshIndex);			} )
-				);
+				meshes.push_back({ &modelRef.get(), meshIndex, numPositions, numIndices });
+				numPositions += modelRef.get().number_of_vertices_for_mesh(meshIndex);
+				numIndices += static_cast<size_t>(modelRef.get().number_of_indices_for_mesh(meshIndex));
 			}
 		}
 
+		std::vector<glm::vec3> positionsData(numPositions);
+		std::vector<uint32_t> indicesData(numIndices);
+
+		parallel_for(meshes.size(), [&](size_t i) {
+			const auto& mesh = meshes[i];
+			mesh.mModel->write_indices_for_meshes<uint32_t>({ mesh.mMeshIndex }, indicesData.data() + mesh.mIndexOffset, mesh.mVertexOffset);
+			mesh.mModel->write_interleaved_vertices_for_meshes<vertex_attribute::position>({ mesh.mMeshIndex }, positionsData.data() + mesh.mVertexOffset);
+		});
+
 		return std::make_tuple( std::move(positionsData), std::move(indicesData) );
 	}
 
@@ -388,7 +592,8 @@ namespace gvk
 		if (aSerializer.mode() == gvk::serializer::mode::serialize) {
 			verticesAndIndices = get_vertices_and_indices(aModelsAndSelectedMeshes);
 		}
-		aSerializer.archive(verticesAndIndices);
+		aSerializer.archive_vector(std::get<std::vector<glm::vec3>>(verticesAndIndices));
+		aSerializer.archive_vector(std::get<std::vector<uint32_t>>(verticesAndIndices));
 		return verticesAndIndices;
 	}
 
@@ -407,17 +612,17 @@ namespace gvk
 			avk::vertex_buffer_meta::create_from_data(positionsData)
 				.describe_only_member(positionsData[0], avk::content_description::position)
 		);
-		positionsBuffer->fill(positionsData.data(), 0, avk::sync::auxiliary_with_barriers(aSyncHandler, {}, {}));
+		record_staged_upload(positionsData.data(), sizeof(positionsData[0]) * positionsData.size(), positionsBuffer, aSyncHandler);
 		// It is fine to let positionsData go out of scope, since its data has been copied to a
-		// staging buffer within create_and_fill, which is lifetime-handled by the command buffer.
+		// staging ring allocation, which is lifetime-handled by the command buffer.
 
 		auto indexBuffer = context().create_buffer(
 			avk::memory_usage::device, aUsageFlags,
 			avk::index_buffer_meta::create_from_data(indicesData)
 		);
-		indexBuffer->fill(indicesData.data(), 0, avk::sync::auxiliary_with_barriers(aSyncHandler, {}, {}));
+		record_staged_upload(indicesData.data(), sizeof(indicesData[0]) * indicesData.size(), indexBuffer, aSyncHandler);
 		// It is fine to let indicesData go out of scope, since its data has been copied to a
-		// staging buffer within create_and_fill, which is lifetime-handled by the command buffer.
+		// staging ring allocation, which is lifetime-handled by the command buffer.
 
 		// Sync after:
 		aSyncHandler.establish_barrier_after_the_operation(avk::pipeline_stage::transfer, avk::write_memory_access{ avk::memory_access::transfer_write_access });
@@ -485,18 +690,182 @@ namespace gvk
 	}
 
 
-	std::vector<glm::vec3> get_normals(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes)
+	scene_geometry_data get_scene_geometry(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet, bool aFlipTexCoords)
 	{
-		std::vector<glm::vec3> normalsData;
+		scene_geometry_data result;
+
+		// Determine all offsets first, s.t. all the meshes can be written in parallel, directly to their final place:
+		std::vector<const gvk::model_t*> models;
+		size_t numVertices = 0;
+		size_t numIndices = 0;
+		for (size_t m = 0; m < aModelsAndSelectedMeshes.size(); ++m) {
+			const auto& modelRef = std::get<avk::resource_reference<const gvk::model_t>>(aModelsAndSelectedMeshes[m]);
+			for (auto meshIndex : std::get<std::vector<mesh_index_t>>(aModelsAndSelectedMeshes[m])) {
+				const auto vertexCount = modelRef.get().number_of_vertices_for_mesh(meshIndex);
+				const auto indexCount = static_cast<size_t>(modelRef.get().number_of_indices_for_mesh(meshIndex));
+				result.mDraws.push_back(scene_geometry_draw{
+					static_cast<uint32_t>(m), meshIndex,
+					static_cast<uint32_t>(indexCount), static_cast<uint32_t>(numIndices),
+					static_cast<int32_t>(numVertices), static_cast<uint32_t>(vertexCount)
+				});
+				models.push_back(&modelRef.get());
+				numVertices += vertexCount;
+				numIndices += indexCount;
+			}
+		}
+		if (numVertices > static_cast<size_t>(std::numeric_limits<int32_t>::max()) || numIndices > static_cast<size_t>(std::numeric_limits<uint32_t>::max())) {
+			throw gvk::runtime_error(fmt::format("The selected meshes contain too many vertices ({}) or indices ({}) to be packed into one scene geometry.", numVertices, numIndices));
+		}
+
+		result.mPositions.resize(numVertices);
+		result.mTexCoords.resize(numVertices);
+		result.mNormals.resize(numVertices);
+		result.mIndices.resize(numIndices);
+
+		parallel_for(result.mDraws.size(), [&](size_t i) {
+			const auto& draw = result.mDraws[i];
+			const auto& model = *models[i];
+			model.write_indices_for_meshes<uint32_t>({ draw.mMeshIndex }, result.mIndices.data() + draw.mFirstIndex);
+			model.write_interleaved_vertices_for_meshes<vertex_attribute::position>({ draw.mMeshIndex }, result.mPositions.data() + draw.mVertexOffset);
+			model.write_interleaved_vertices_for_meshes<vertex_attribute::normal>({ draw.mMeshIndex }, result.mNormals.data() + draw.mVertexOffset);
+			// The texture coordinate set is only known at runtime => can't use a vertex_attribute::texture_coordinates here:
+			auto texCoords = aFlipTexCoords
+				? model.texture_coordinates_for_mesh<glm::vec2>([](const glm::vec2& aValue){ return glm::vec2{aValue.x, 1.0f - aValue.y}; }, draw.mMeshIndex, aTexCoordSet)
+				: model.texture_coordinates_for_mesh<glm::vec2>(draw.mMeshIndex, aTexCoordSet);
+			std::copy(std::begin(texCoords), std::end(texCoords), result.mTexCoords.begin() + draw.mVertexOffset);
+		});
+
+		return result;
+	}
+
+	scene_geometry_data get_scene_geometry_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet, bool aFlipTexCoords)
+	{
+		scene_geometry_data result;
+		if (aSerializer.mode() == gvk::serializer::mode::serialize) {
+			result = get_scene_geometry(aModelsAndSelectedMeshes, aTexCoordSet, aFlipTexCoords);
+		}
+		aSerializer.archive_vector(result.mPositions);
+		aSerializer.archive_vector(result.mTexCoords);
+		aSerializer.archive_vector(result.mNormals);
+		aSerializer.archive_vector(result.mIndices);
+		aSerializer.archive_vector(result.mDraws);
+		return result;
+	}
+
+	std::vector<vk::DrawIndexedIndirectCommand> get_draw_indexed_indirect_commands(const std::vector<scene_geometry_draw>& aDraws, uint32_t aInstanceCount)
+	{
+		std::vector<vk::DrawIndexedIndirectCommand> commands;
+		commands.reserve(aDraws.size());
+		for (size_t i = 0; i < aDraws.size(); ++i) {
+			const auto& draw = aDraws[i];
+			commands.emplace_back(draw.mIndexCount, aInstanceCount, draw.mFirstIndex, draw.mVertexOffset, static_cast<uint32_t>(i));
+		}
+		return commands;
+	}
+
+	static inline scene_geometry create_scene_geometry(scene_geometry_data aData, vk::BufferUsageFlags aUsageFlags, avk::sync aSyncHandler)
+	{
+		if (aData.mDraws.empty()) {
+			throw gvk::logic_error("Can't create a scene geometry without any meshes.");
+		}
+
+		aSyncHandler.get_or_create_command_buffer();
+		aSyncHandler.establish_barrier_before_the_operation(avk::pipeline_stage::transfer, avk::read_memory_access{ avk::memory_access::transfer_read_access });
+
+		scene_geometry result;
+
+		result.mPositionsBuffer = context().create_buffer(
+			avk::memory_usage::device, aUsageFlags,
+			avk::vertex_buffer_meta::create_from_data(aData.mPositions)
+				.describe_only_member(aData.mPositions[0], avk::content_description::position)
+		);
+		record_staged_upload(aData.mPositions.data(), sizeof(aData.mPositions[0]) * aData.mPositions.size(), result.mPositionsBuffer, aSyncHandler);
+
+		result.mTexCoordsBuffer = context().create_buffer(
+			avk::memory_usage::device, aUsageFlags,
+			avk::vertex_buffer_meta::create_from_data(aData.mTexCoords)
+		);
+		record_staged_upload(aData.mTexCoords.data(), sizeof(aData.mTexCoords[0]) * aData.mTexCoords.size(), result.mTexCoordsBuffer, aSyncHandler);
+
+		result.mNormalsBuffer = context().create_buffer(
+			avk::memory_usage::device, aUsageFlags,
+			avk::vertex_buffer_meta::create_from_data(aData.mNormals)
+		);
+		record_staged_upload(aData.mNormals.data(), sizeof(aData.mNormals[0]) * aData.mNormals.size(), result.mNormalsBuffer, aSyncHandler);
+
+		result.mIndexBuffer = context().create_buffer(
+			avk::memory_usage::device, aUsageFlags,
+			avk::index_buffer_meta::create_from_data(aData.mIndices)
+		);
+		record_staged_upload(aData.mIndices.data(), sizeof(aData.mIndices[0]) * aData.mIndices.size(), result.mIndexBuffer, aSyncHandler);
+
+		const auto commands = get_draw_indexed_indirect_commands(aData.mDraws);
+		result.mDrawCommandsBuffer = context().create_buffer(
+			avk::memory_usage::device, vk::BufferUsageFlagBits::eIndirectBuffer,
+			avk::generic_buffer_meta::create_from_size(sizeof(commands[0]) * commands.size())
+		);
+		record_staged_upload(commands.data(), sizeof(commands[0]) * commands.size(), result.mDrawCommandsBuffer, aSyncHandler);
+		// All the data has been copied into staging ring allocations, which are lifetime-handled by the command buffer.
+
+		aSyncHandler.establish_barrier_after_the_operation(avk::pipeline_stage::transfer, avk::write_memory_access{ avk::memory_access::transfer_write_access });
+		aSyncHandler.submit_and_sync(); // Return command buffer is not supported here.
+
+		result.mDraws = std::move(aData.mDraws);
+		return result;
+	}
+
+	scene_geometry create_scene_geometry(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet, bool aFlipTexCoords, vk::BufferUsageFlags aUsageFlags, avk::sync aSyncHandler)
+	{
+		return create_scene_geometry(get_scene_geometry(aModelsAndSelectedMeshes, aTexCoordSet, aFlipTexCoords), aUsageFlags, std::move(aSyncHandler));
+	}
+
+	avk::buffer create_baked_animation_buffer(const baked_animation& aBakedAnimation, vk::BufferUsageFlags aUsageFlags, avk::sync aSyncHandler)
+	{
+		if (aBakedAnimation.mData.empty()) {
+			throw gvk::logic_error("Can't create a buffer for a baked animation without any data.");
+		}
+		auto buffer = context().create_buffer(
+			avk::memory_usage::device, aUsageFlags,
+			avk::storage_buffer_meta::create_from_data(aBakedAnimation.mData)
+		);
+		fill_device_buffer(buffer, aBakedAnimation.mData.data(), aBakedAnimation.size_in_bytes(), aSyncHandler);
+		return buffer;
+	}
+
+	scene_geometry create_scene_geometry_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet, bool aFlipTexCoords, vk::BufferUsageFlags aUsageFlags, avk::sync aSyncHandler)
+	{
+		return create_scene_geometry(get_scene_geometry_cached(aSerializer, aModelsAndSelectedMeshes, aTexCoordSet, aFlipTexCoords), aUsageFlags, std::move(aSyncHandler));
+	}
 
+	std::vector<mesh_bounds> get_mesh_bounds(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes)
+	{
+		std::vector<mesh_bounds> result;
 		for (auto& pair : aModelsAndSelectedMeshes) {
 			const auto& modelRef = std::get<avk::resource_reference<const gvk::model_t>>(pair);
 			for (auto meshIndex : std::get<std::vector<mesh_index_t>>(pair)) {
-				insert_into(normalsData, modelRef.get().normals_for_mesh(meshIndex));
+				result.push_back(modelRef.get().transformed_bounds_for_mesh(meshIndex));
 			}
 		}
+		return result;
+	}
 
-		return normalsData;
+	std::vector<mesh_bounds> get_mesh_bounds_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes)
+	{
+		std::vector<mesh_bounds> boundsData;
+		if (aSerializer.mode() == gvk::serializer::mode::serialize) {
+			boundsData = get_mesh_bounds(aModelsAndSelectedMeshes);
+		}
+		aSerializer.archive_vector(boundsData);
+
+		return boundsData;
+	}
+
+
+	std::vector<glm::vec3> get_normals(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes)
+	{
+		return gather_vertex_data_of_meshes<glm::vec3>(aModelsAndSelectedMeshes, [&](const gvk::model_t& aModel, mesh_index_t aMeshIndex) {
+			return aModel.normals_for_mesh(aMeshIndex);
+		});
 	}
 
 	std::vector<glm::vec3> get_normals_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes)
@@ -505,7 +874,7 @@ namespace gvk
 		if (aSerializer.mode() == gvk::serializer::mode::serialize) {
 			normalsData = get_normals(aModelsAndSelectedMeshes);
 		}
-		aSerializer.archive(normalsData);
+		aSerializer.archive_vector(normalsData);
 
 		return normalsData;
 	}
@@ -516,9 +885,9 @@ namespace gvk
 			avk::memory_usage::device, {},
 			avk::vertex_buffer_meta::create_from_data(aNormalsData)
 		);
-		normalsBuffer->fill(aNormalsData.data(), 0, std::move(aSyncHandler));
+		fill_device_buffer(normalsBuffer, aNormalsData.data(), sizeof(aNormalsData[0]) * aNormalsData.size(), aSyncHandler);
 		// It is fine to let normalsData go out of scope, since its data has been copied to a
-		// staging buffer within create_and_fill, which is lifetime-handled by the command buffer.
+		// staging ring allocation, which is lifetime-handled by the command buffer.
 
 		return normalsBuffer;
 	}
@@ -564,16 +933,9 @@ namespace gvk
 
 	std::vector<glm::vec3> get_tangents(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes)
 	{
-		std::vector<glm::vec3> tangentsData;
-
-		for (auto& pair : aModelsAndSelectedMeshes) {
-			const auto& modelRef = std::get<avk::resource_reference<const gvk::model_t>>(pair);
-			for (auto meshIndex : std::get<std::vector<mesh_index_t>>(pair)) {
-				insert_into(tangentsData, modelRef.get().tangents_for_mesh(meshIndex));
-			}
-		}
-
-		return tangentsData;
+		return gather_vertex_data_of_meshes<glm::vec3>(aModelsAndSelectedMeshes, [&](const gvk::model_t& aModel, mesh_index_t aMeshIndex) {
+			return aModel.tangents_for_mesh(aMeshIndex);
+		});
 	}
 
 	std::vector<glm::vec3> get_tangents_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes)
@@ -583,7 +945,7 @@ namespace gvk
 		if (aSerializer.mode() == gvk::serializer::mode::serialize) {
 			tangentsData = get_tangents(aModelsAndSelectedMeshes);
 		}
-		aSerializer.archive(tangentsData);
+		aSerializer.archive_vector(tangentsData);
 
 		return tangentsData;
 	}
@@ -594,9 +956,9 @@ namespace gvk
 			avk::memory_usage::device, {},
 			avk::vertex_buffer_meta::create_from_data(aTangentsData)
 		);
-		tangentsBuffer->fill(aTangentsData.data(), 0, std::move(aSyncHandler));
+		fill_device_buffer(tangentsBuffer, aTangentsData.data(), sizeof(aTangentsData[0]) * aTangentsData.size(), aSyncHandler);
 		// It is fine to let tangentsData go out of scope, since its data has been copied to a
-		// staging buffer within create_and_fill, which is lifetime-handled by the command buffer.
+		// staging ring allocation, which is lifetime-handled by the command buffer.
 
 		return tangentsBuffer;
 	}
@@ -648,16 +1010,9 @@ namespace gvk
 
 	std::vector<glm::vec3> get_bitangents(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes)
 	{
-		std::vector<glm::vec3> bitangentsData;
-
-		for (auto& pair : aModelsAndSelectedMeshes) {
-			const auto& modelRef = std::get<avk::resource_reference<const gvk::model_t>>(pair);
-			for (auto meshIndex : std::get<std::vector<mesh_index_t>>(pair)) {
-				insert_into(bitangentsData, modelRef.get().bitangents_for_mesh(meshIndex));
-			}
-		}
-
-		return bitangentsData;
+		return gather_vertex_data_of_meshes<glm::vec3>(aModelsAndSelectedMeshes, [&](const gvk::model_t& aModel, mesh_index_t aMeshIndex) {
+			return aModel.bitangents_for_mesh(aMeshIndex);
+		});
 	}
 
 	std::vector<glm::vec3> get_bitangents_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes)
@@ -667,7 +1022,7 @@ namespace gvk
 		if (aSerializer.mode() == gvk::serializer::mode::serialize) {
 			bitangentsData = get_bitangents(aModelsAndSelectedMeshes);
 		}
-		aSerializer.archive(bitangentsData);
+		aSerializer.archive_vector(bitangentsData);
 
 		return bitangentsData;
 	}
@@ -688,16 +1043,9 @@ namespace gvk
 
 	std::vector<glm::vec4> get_colors(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, int aColorsSet)
 	{
-		std::vector<glm::vec4> colorsData;
-
-		for (auto& pair : aModelsAndSelectedMeshes) {
-			const auto& modelRef = std::get<avk::resource_reference<const gvk::model_t>>(pair);
-			for (auto meshIndex : std::get<std::vector<mesh_index_t>>(pair)) {
-				insert_into(colorsData, modelRef.get().colors_for_mesh(meshIndex, aColorsSet));
-			}
-		}
-
-		return colorsData;
+		return gather_vertex_data_of_meshes<glm::vec4>(aModelsAndSelectedMeshes, [&](const gvk::model_t& aModel, mesh_index_t aMeshIndex) {
+			return aModel.colors_for_mesh(aMeshIndex, aColorsSet);
+		});
 	}
 
 	std::vector<glm::vec4> get_colors_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, int aColorsSet)
@@ -707,7 +1055,7 @@ namespace gvk
 		if (aSerializer.mode() == gvk::serializer::mode::serialize) {
 			colorsData = get_colors(aModelsAndSelectedMeshes, aColorsSet);
 		}
-		aSerializer.archive(colorsData);
+		aSerializer.archive_vector(colorsData);
 
 		return colorsData;
 	}
@@ -718,9 +1066,9 @@ namespace gvk
 			avk::memory_usage::device, {},
 			avk::vertex_buffer_meta::create_from_data(aColorsData)
 		);
-		colorsBuffer->fill(aColorsData.data(), 0, std::move(aSyncHandler));
+		fill_device_buffer(colorsBuffer, aColorsData.data(), sizeof(aColorsData[0]) * aColorsData.size(), aSyncHandler);
 		// It is fine to let colorsData go out of scope, since its data has been copied to a
-		// staging buffer within create_and_fill, which is lifetime-handled by the command buffer.
+		// staging ring allocation, which is lifetime-handled by the command buffer.
 
 		return colorsBuffer;
 	}
@@ -765,16 +1113,9 @@ namespace gvk
 
 	std::vector<glm::vec4> get_bone_weights(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, bool aNormalizeBoneWeights)
 	{
-		std::vector<glm::vec4> boneWeightsData;
-
-		for (auto& pair : aModelsAndSelectedMeshes) {
-			const auto& modelRef = std::get<avk::resource_reference<const gvk::model_t>>(pair);
-			for (auto meshIndex : std::get<std::vector<mesh_index_t>>(pair)) {
-				insert_into(boneWeightsData, modelRef.get().bone_weights_for_mesh(meshIndex, aNormalizeBoneWeights));
-			}
-		}
-
-		return boneWeightsData;
+		return gather_vertex_data_of_meshes<glm::vec4>(aModelsAndSelectedMeshes, [&](const gvk::model_t& aModel, mesh_index_t aMeshIndex) {
+			return aModel.bone_weights_for_mesh(aMeshIndex, aNormalizeBoneWeights);
+		});
 	}
 
 	std::vector<glm::vec4> get_bone_weights_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, bool aNormalizeBoneWeights)
@@ -784,7 +1125,7 @@ namespace gvk
 		if (aSerializer.mode() == gvk::serializer::mode::serialize) {
 			boneWeightsData = get_bone_weights(aModelsAndSelectedMeshes, aNormalizeBoneWeights);
 		}
-		aSerializer.archive(boneWeightsData);
+		aSerializer.archive_vector(boneWeightsData);
 
 		return boneWeightsData;
 	}
@@ -795,9 +1136,9 @@ namespace gvk
 			avk::memory_usage::device, {},
 			avk::vertex_buffer_meta::create_from_data(aBoneWeightsData)
 		);
-		boneWeightsBuffer->fill(aBoneWeightsData.data(), 0, std::move(aSyncHandler));
+		fill_device_buffer(boneWeightsBuffer, aBoneWeightsData.data(), sizeof(aBoneWeightsData[0]) * aBoneWeightsData.size(), aSyncHandler);
 		// It is fine to let boneWeightsData go out of scope, since its data has been copied to a
-		// staging buffer within create_and_fill, which is lifetime-handled by the command buffer.
+		// staging ring allocation, which is lifetime-handled by the command buffer.
 
 		return boneWeightsBuffer;
 	}
@@ -852,16 +1193,9 @@ namespace gvk
 
 	std::vector<glm::uvec4> get_bone_indices(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aBoneIndexOffset)
 	{
-		std::vector<glm::uvec4> boneIndicesData;
-
-		for (auto& pair : aModelsAndSelectedMeshes) {
-			const auto& modelRef = std::get<avk::resource_reference<const gvk::model_t>>(pair);
-			for (auto meshIndex : std::get<std::vector<mesh_index_t>>(pair)) {
-				insert_into(boneIndicesData, modelRef.get().bone_indices_for_mesh(meshIndex, aBoneIndexOffset));
-			}
-		}
-
-		return boneIndicesData;
+		return gather_vertex_data_of_meshes<glm::uvec4>(aModelsAndSelectedMeshes, [&](const gvk::model_t& aModel, mesh_index_t aMeshIndex) {
+			return aModel.bone_indices_for_mesh(aMeshIndex, aBoneIndexOffset);
+		});
 	}
 
 	std::vector<glm::uvec4> get_bone_indices_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aBoneIndexOffset)
@@ -871,7 +1205,7 @@ namespace gvk
 		if (aSerializer.mode() == gvk::serializer::mode::serialize) {
 			boneIndicesData = get_bone_indices(aModelsAndSelectedMeshes, aBoneIndexOffset);
 		}
-		aSerializer.archive(boneIndicesData);
+		aSerializer.archive_vector(boneIndicesData);
 
 		return boneIndicesData;
 	}
@@ -882,9 +1216,9 @@ namespace gvk
 			avk::memory_usage::device, {},
 			avk::vertex_buffer_meta::create_from_data(aBoneIndicesData)
 		);
-		boneIndicesBuffer->fill(aBoneIndicesData.data(), 0, std::move(aSyncHandler));
+		fill_device_buffer(boneIndicesBuffer, aBoneIndicesData.data(), sizeof(aBoneIndicesData[0]) * aBoneIndicesData.size(), aSyncHandler);
 		// It is fine to let boneIndicesData go out of scope, since its data has been copied to a
-		// staging buffer within create_and_fill, which is lifetime-handled by the command buffer.
+		// staging ring allocation, which is lifetime-handled by the command buffer.
 
 		return boneIndicesBuffer;
 	}
@@ -954,7 +1288,7 @@ namespace gvk
 		if (aSerializer.mode() == gvk::serializer::mode::serialize) {
 			boneIndicesData = get_bone_indices_for_single_target_buffer(aModelsAndSelectedMeshes, aInitialBoneIndexOffset);
 		}
-		aSerializer.archive(boneIndicesData);
+		aSerializer.archive_vector(boneIndicesData);
 
 		return boneIndicesData;
 	}
@@ -976,16 +1310,9 @@ namespace gvk
 
 	std::vector<glm::uvec4> get_bone_indices_for_single_target_buffer(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, const std::vector<mesh_index_t>& aReferenceMeshIndices)
 	{
-		std::vector<glm::uvec4> boneIndicesData;
-
-		for (auto& pair : aModelsAndSelectedMeshes) {
-			const auto& modelRef = std::get<avk::resource_reference<const gvk::model_t>>(pair);
-			for (auto meshIndex : std::get<std::vector<mesh_index_t>>(pair)) {
-				insert_into(boneIndicesData, modelRef.get().bone_indices_for_mesh_for_single_target_buffer(meshIndex, aReferenceMeshIndices));
-			}
-		}
-
-		return boneIndicesData;
+		return gather_vertex_data_of_meshes<glm::uvec4>(aModelsAndSelectedMeshes, [&](const gvk::model_t& aModel, mesh_index_t aMeshIndex) {
+			return aModel.bone_indices_for_mesh_for_single_target_buffer(aMeshIndex, aReferenceMeshIndices);
+		});
 	}
 
 	std::vector<glm::uvec4> get_bone_indices_for_single_target_buffer_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, const std::vector<mesh_index_t>& aReferenceMeshIndices)
@@ -995,7 +1322,7 @@ namespace gvk
 		if (aSerializer.mode() == gvk::serializer::mode::serialize) {
 			boneIndicesData = get_bone_indices_for_single_target_buffer(aModelsAndSelectedMeshes, aReferenceMeshIndices);
 		}
-		aSerializer.archive(boneIndicesData);
+		aSerializer.archive_vector(boneIndicesData);
 
 		return boneIndicesData;
 	}
@@ -1018,16 +1345,9 @@ namespace gvk
 
 	std::vector<glm::vec2> get_2d_texture_coordinates(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet)
 	{
-		std::vector<glm::vec2> texCoordsData;
-
-		for (auto& pair : aModelsAndSelectedMeshes) {
-			const auto& modelRef = std::get<avk::resource_reference<const gvk::model_t>>(pair);
-			for (auto meshIndex : std::get<std::vector<mesh_index_t>>(pair)) {
-				insert_into(texCoordsData, modelRef.get().texture_coordinates_for_mesh<glm::vec2>(meshIndex, aTexCoordSet));
-			}
-		}
-
-		return texCoordsData;
+		return gather_vertex_data_of_meshes<glm::vec2>(aModelsAndSelectedMeshes, [&](const gvk::model_t& aModel, mesh_index_t aMeshIndex) {
+			return aModel.texture_coordinates_for_mesh<glm::vec2>(aMeshIndex, aTexCoordSet);
+		});
 	}
 
 	std::vector<glm::vec2> get_2d_texture_coordinates_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet)
@@ -1037,7 +1357,7 @@ namespace gvk
 		if (aSerializer.mode() == gvk::serializer::mode::serialize) {
 			texCoordsData = get_2d_texture_coordinates(aModelsAndSelectedMeshes, aTexCoordSet);
 		}
-		aSerializer.archive(texCoordsData);
+		aSerializer.archive_vector(texCoordsData);
 
 		return texCoordsData;
 	}
@@ -1048,9 +1368,9 @@ namespace gvk
 			avk::memory_usage::device, {},
 			avk::vertex_buffer_meta::create_from_data(aTexCoordsData)
 		);
-		texCoordsBuffer->fill(aTexCoordsData.data(), 0, std::move(aSyncHandler));
+		fill_device_buffer(texCoordsBuffer, aTexCoordsData.data(), sizeof(aTexCoordsData[0]) * aTexCoordsData.size(), aSyncHandler);
 		// It is fine to let texCoordsData go out of scope, since its data has been copied to a
-		// staging buffer within create_and_fill, which is lifetime-handled by the command buffer.
+		// staging ring allocation, which is lifetime-handled by the command buffer.
 
 		return texCoordsBuffer;
 	}
@@ -1095,16 +1415,9 @@ namespace gvk
 
 	std::vector<glm::vec2> get_2d_texture_coordinates_flipped(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet)
 	{
-		std::vector<glm::vec2> texCoordsData;
-
-		for (auto& pair : aModelsAndSelectedMeshes) {
-			const auto& modelRef = std::get<avk::resource_reference<const gvk::model_t>>(pair);
-			for (auto meshIndex : std::get<std::vector<mesh_index_t>>(pair)) {
-				insert_into(texCoordsData, modelRef.get().texture_coordinates_for_mesh<glm::vec2>([](const glm::vec2& aValue){ return glm::vec2{aValue.x, 1.0f - aValue.y}; }, meshIndex, aTexCoordSet));
-			}
-		}
-
-		return texCoordsData;
+		return gather_vertex_data_of_meshes<glm::vec2>(aModelsAndSelectedMeshes, [&](const gvk::model_t& aModel, mesh_index_t aMeshIndex) {
+			return aModel.texture_coordinates_for_mesh<glm::vec2>([](const glm::vec2& aValue){ return glm::vec2{aValue.x, 1.0f - aValue.y}; }, aMeshIndex, aTexCoordSet);
+		});
 	}
 
 	std::vector<glm::vec2> get_2d_texture_coordinates_flipped_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet)
@@ -1114,7 +1427,7 @@ namespace gvk
 		if (aSerializer.mode() == gvk::serializer::mode::serialize) {
 			texCoordsData = get_2d_texture_coordinates_flipped(aModelsAndSelectedMeshes, aTexCoordSet);
 		}
-		aSerializer.archive(texCoordsData);
+		aSerializer.archive_vector(texCoordsData);
 
 		return texCoordsData;
 	}
@@ -1159,16 +1472,9 @@ namespace gvk
 
 	std::vector<glm::vec3> get_3d_texture_coordinates(const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet)
 	{
-		std::vector<glm::vec3> texCoordsData;
-
-		for (auto& pair : aModelsAndSelectedMeshes) {
-			const auto& modelRef = std::get<avk::resource_reference<const gvk::model_t>>(pair);
-			for (auto meshIndex : std::get<std::vector<mesh_index_t>>(pair)) {
-				insert_into(texCoordsData, modelRef.get().texture_coordinates_for_mesh<glm::vec3>(meshIndex, aTexCoordSet));
-			}
-		}
-
-		return texCoordsData;
+		return gather_vertex_data_of_meshes<glm::vec3>(aModelsAndSelectedMeshes, [&](const gvk::model_t& aModel, mesh_index_t aMeshIndex) {
+			return aModel.texture_coordinates_for_mesh<glm::vec3>(aMeshIndex, aTexCoordSet);
+		});
 	}
 
 	std::vector<glm::vec3> get_3d_texture_coordinates_cached(gvk::serializer& aSerializer, const std::vector<std::tuple<avk::resource_reference<const gvk::model_t>, std::vector<mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet)
@@ -1178,7 +1484,7 @@ namespace gvk
 		if (aSerializer.mode() == gvk::serializer::mode::serialize) {
 			texCoordsData = get_3d_texture_coordinates(aModelsAndSelectedMeshes, aTexCoordSet);
 		}
-		aSerializer.archive(texCoordsData);
+		aSerializer.archive_vector(texCoordsData);
 
 		return texCoordsData;
 	}
@@ -1189,9 +1495,9 @@ namespace gvk
 			avk::memory_usage::device, {},
 			avk::vertex_buffer_meta::create_from_data(aTexCoordsData)
 		);
-		texCoordsBuffer->fill(aTexCoordsData.data(), 0, std::move(aSyncHandler));
+		fill_device_buffer(texCoordsBuffer, aTexCoordsData.data(), sizeof(aTexCoordsData[0]) * aTexCoordsData.size(), aSyncHandler);
 		// It is fine to let texCoordsData go out of scope, since its data has been copied to a
-		// staging buffer within create_and_fill, which is lifetime-handled by the command buffer.
+		// staging ring allocation, which is lifetime-handled by the command buffer.
 
 		return texCoordsBuffer;
 	}
@@ -0,0 +1,187 @@
+#include <gvk.hpp>
+
+namespace gvk
+{
+	// Parameters of the vertex scoring function, as proposed by Tom Forsyth:
+	static constexpr float sCacheDecayPower = 1.5f;
+	static constexpr float sLastTriangleScore = 0.75f;
+	static constexpr float sValenceBoostScale = 2.0f;
+	static constexpr float sValenceBoostPower = 0.5f;
+
+	static float forsyth_vertex_score(int aCachePosition, uint32_t aRemainingValence, uint32_t aCacheSize)
+	{
+		if (0u == aRemainingValence) {
+			return -1.0f; // No triangle needs this vertex anymore
+		}
+
+		float score = 0.0f;
+		if (aCachePosition >= 0) {
+			if (aCachePosition < 3) {
+				// Used by the last triangle => fixed score, s.t. it does not matter which of its edges is continued
+				score = sLastTriangleScore;
+			}
+			else {
+				const float scaler = 1.0f / static_cast<float>(aCacheSize - 3u);
+				score = std::pow(1.0f - static_cast<float>(aCachePosition - 3) * scaler, sCacheDecayPower);
+			}
+		}
+		// Prefer vertices with only few remaining triangles, s.t. no lone triangles are left behind:
+		score += sValenceBoostScale * std::pow(static_cast<float>(aRemainingValence), -sValenceBoostPower);
+		return score;
+	}
+
+	std::vector<uint32_t> optimize_vertex_cache(std::span<const uint32_t> aIndices, size_t aNumVertices, uint32_t aCacheSize)
+	{
+		if (0 != aIndices.size() % 3) {
+			throw gvk::logic_error(fmt::format("optimize_vertex_cache requires a triangle list, but the number of indices ({}) is not a multiple of three.", aIndices.size()));
+		}
+		aCacheSize = std::max(aCacheSize, 4u);
+		constexpr size_t noTriangle = std::numeric_limits<size_t>::max();
+		const size_t numTriangles = aIndices.size() / 3;
+
+		// Build the vertex-to-triangles adjacency. The first remainingValence entries of each
+		// vertex's range are the triangles which have not been added to the result yet:
+		std::vector<uint32_t> remainingValence(aNumVertices, 0u);
+		for (auto index : aIndices) {
+			if (index >= aNumVertices) {
+				throw gvk::logic_error(fmt::format("Index {} is out of range for {} vertices.", index, aNumVertices));
+			}
+			++remainingValence[index];
+		}
+		std::vector<size_t> adjacencyOffsets(aNumVertices + 1, 0);
+		for (size_t v = 0; v < aNumVertices; ++v) {
+			adjacencyOffsets[v + 1] = adjacencyOffsets[v] + remainingValence[v];
+		}
+		std::vector<size_t> adjacency(aIndices.size());
+		{
+			std::vector<size_t> writePos(std::begin(adjacencyOffsets), std::end(adjacencyOffsets) - 1);
+			for (size_t i = 0; i < aIndices.size(); ++i) {
+				adjacency[writePos[aIndices[i]]++] = i / 3;
+			}
+		}
+
+		std::vector<int> cachePositions(aNumVertices, -1);
+		std::vector<float> vertexScores(aNumVertices);
+		for (size_t v = 0; v < aNumVertices; ++v) {
+			vertexScores[v] = forsyth_vertex_score(-1, remainingValence[v], aCacheSize);
+		}
+
+		std::vector<float> triangleScores(numTriangles);
+		std::vector<bool> triangleAdded(numTriangles, false);
+		size_t bestTriangle = noTriangle;
+		float bestScore = -1.0f;
+		for (size_t t = 0; t < numTriangles; ++t) {
+			triangleScores[t] = vertexScores[aIndices[3 * t]] + vertexScores[aIndices[3 * t + 1]] + vertexScores[aIndices[3 * t + 2]];
+			if (triangleScores[t] > bestScore) {
+				bestScore = triangleScores[t];
+				bestTriangle = t;
+			}
+		}
+
+		std::vector<uint32_t> result;
+		result.reserve(aIndices.size());
+		// The modeled LRU cache; it temporarily holds up to three more entries than it can hold,
+		// which are the ones that have just been evicted.
+		std::vector<uint32_t> cache;
+		std::vector<uint32_t> newCache;
+		cache.reserve(aCacheSize + 3);
+		newCache.reserve(aCacheSize + 3);
+		size_t nextUnaddedTriangle = 0;
+
+		for (size_t n = 0; n < numTriangles; ++n) {
+			if (noTriangle == bestTriangle) {
+				// None of the triangles adjacent to cached vertices is left => continue with any triangle:
+				while (triangleAdded[nextUnaddedTriangle]) {
+					++nextUnaddedTriangle;
+				}
+				bestTriangle = nextUnaddedTriangle;
+			}
+
+			const size_t tri = bestTriangle;
+			triangleAdded[tri] = true;
+			newCache.clear();
+			for (size_t k = 0; k < 3; ++k) {
+				const auto v = aIndices[3 * tri + k];
+				result.push_back(v);
+
+				// Remove the triangle from the vertex's remaining triangles:
+				auto first = std::begin(adjacency) + adjacencyOffsets[v];
+				auto last = first + remainingValence[v];
+				std::iter_swap(std::find(first, last, tri), last - 1);
+				--remainingValence[v];
+
+				if (std::find(std::begin(newCache), std::end(newCache), v) == std::end(newCache)) {
+					newCache.push_back(v);
+				}
+			}
+
+			// Move the triangle's vertices to the front of the cache:
+			const auto numTriangleVertices = static_cast<std::ptrdiff_t>(newCache.size());
+			for (auto v : cache) {
+				if (std::find(std::begin(newCache), std::begin(newCache) + numTriangleVertices, v) == std::begin(newCache) + numTriangleVertices) {
+					newCache.push_back(v);
+				}
+			}
+			std::swap(cache, newCache);
+
+			// Update the scores of all vertices which were in the cache (including the evicted ones),
+			// and of all the remaining triangles which use them:
+			for (size_t i = 0; i < cache.size(); ++i) {
+				const auto v = cache[i];
+				cachePositions[v] = i < aCacheSize ? static_cast<int>(i) : -1;
+				vertexScores[v] = forsyth_vertex_score(cachePositions[v], remainingValence[v], aCacheSize);
+			}
+			bestTriangle = noTriangle;
+			bestScore = -1.0f;
+			for (auto v : cache) {
+				for (size_t a = adjacencyOffsets[v], end = adjacencyOffsets[v] + remainingValence[v]; a < end; ++a) {
+					const auto t = adjacency[a];
+					triangleScores[t] = vertexScores[aIndices[3 * t]] + vertexScores[aIndices[3 * t + 1]] + vertexScores[aIndices[3 * t + 2]];
+					if (triangleScores[t] > bestScore) {
+						bestScore = triangleScores[t];
+						bestTriangle = t;
+					}
+				}
+			}
+			if (cache.size() > aCacheSize) {
+				cache.resize(aCacheSize);
+			}
+		}
+
+		return result;
+	}
+
+	std::vector<uint32_t> optimize_vertex_fetch_remap(std::span<const uint32_t> aIndices, size_t aNumVertices)
+	{
+		constexpr uint32_t unassigned = std::numeric_limits<uint32_t>::max();
+		std::vector<uint32_t> remap(aNumVertices, unassigned);
+		uint32_t nextVertex = 0u;
+		for (auto index : aIndices) {
+			if (unassigned == remap[index]) {
+				remap[index] = nextVertex++;
+			}
+		}
+		for (auto& entry : remap) {
+			if (unassigned == entry) {
+				entry = nextVertex++;
+			}
+		}
+		return remap;
+	}
+
+	float average_cache_miss_ratio(std::span<const uint32_t> aIndices, size_t aNumVertices, uint32_t aCacheSize)
+	{
+		if (aIndices.size() < 3) {
+			return 0.0f;
+		}
+		// A vertex is in the FIFO cache if fewer than aCacheSize misses have occurred since it was inserted:
+		std::vector<size_t> insertedAt(aNumVertices, std::numeric_limits<size_t>::max());
+		size_t numMisses = 0;
+		for (auto index : aIndices) {
+			if (insertedAt[index] == std::numeric_limits<size_t>::max() || numMisses - insertedAt[index] >= aCacheSize) {
+				insertedAt[index] = numMisses++;
+			}
+		}
+		return static_cast<float>(numMisses) / static_cast<float>(aIndices.size() / 3);
+	}
+}
@@ -9,11 +9,16 @@ namespace gvk
 		model_t result;
 		result.mModelPath = avk::clean_up_path(aPath);
 		result.mImporter = std::make_unique<Assimp::Importer>();
-		result.mScene = result.mImporter->ReadFile(aPath, aAssimpFlags);
+		result.mScene = result.mImporter->ReadFile(aPath, aAssimpFlags & ~sOptimizeVertexOrder);
 		if (nullptr == result.mScene) {
 			throw gvk::runtime_error(fmt::format("Loading model from '{}' failed.", aPath));
 		}
 		result.initialize_materials();
+		result.initialize_node_table();
+		result.initialize_mesh_bounds();
+		if (0u != (aAssimpFlags & sOptimizeVertexOrder)) {
+			result.optimize_vertex_order();
+		}
 		return result;
 	}
 	
@@ -22,15 +27,95 @@ namespace gvk
 		model_t result;
 		result.mModelPath = "";
 		result.mImporter = std::make_unique<Assimp::Importer>();
-		result.mScene = result.mImporter->ReadFileFromMemory(aMemory.c_str(), aMemory.size(), aAssimpFlags);
+		result.mScene = result.mImporter->ReadFileFromMemory(aMemory.c_str(), aMemory.size(), aAssimpFlags & ~sOptimizeVertexOrder);
 		if (nullptr == result.mScene) {
 			throw gvk::runtime_error("Loading model from memory failed.");
 		}
 		result.initialize_materials();
+		result.initialize_node_table();
+		result.initialize_mesh_bounds();
+		if (0u != (aAssimpFlags & sOptimizeVertexOrder)) {
+			result.optimize_vertex_order();
+		}
 		return result;
 	}
 
 	
+	template <typename T>
+	static void reorder_vertex_data(T* aData, const std::vector<uint32_t>& aRemap)
+	{
+		if (nullptr == aData) {
+			return;
+		}
+		std::vector<T> original(aData, aData + aRemap.size());
+		for (size_t i = 0; i < aRemap.size(); ++i) {
+			aData[aRemap[i]] = original[i];
+		}
+	}
+
+	void model_t::optimize_vertex_order(uint32_t aCacheSize)
+	{
+		// The scene is owned by the importer. Just like Assimp's post-processing steps, modify it in place:
+		auto* scene = const_cast<aiScene*>(mScene);
+
+		parallel_for(scene->mNumMeshes, [&](size_t meshIndex) {
+			aiMesh* paiMesh = scene->mMeshes[meshIndex];
+			const size_t numVertices = static_cast<size_t>(paiMesh->mNumVertices);
+			for (unsigned int i = 0; i < paiMesh->mNumFaces; ++i) {
+				if (3u != paiMesh->mFaces[i].mNumIndices) {
+					LOG_WARNING(fmt::format("The mesh at index {} does not consist of triangles only. Its vertex order is not optimized. Load it with aiProcess_Triangulate and aiProcess_SortByPType to fix that.", meshIndex));
+					return;
+				}
+			}
+
+			std::vector<uint32_t> indices(static_cast<size_t>(paiMesh->mNumFaces) * 3);
+			write_indices_for_meshes<uint32_t>({ meshIndex }, indices.data());
+			const auto acmrBefore = average_cache_miss_ratio(indices, numVertices);
+			indices = optimize_vertex_cache(indices, numVertices, aCacheSize);
+			const auto remap = optimize_vertex_fetch_remap(indices, numVertices);
+			LOG_DEBUG(fmt::format("Optimized vertex order of mesh[{}] with {} triangles: ACMR {:.3f} -> {:.3f}", meshIndex, paiMesh->mNumFaces, acmrBefore, average_cache_miss_ratio(indices, numVertices)));
+
+			for (unsigned int i = 0; i < paiMesh->mNumFaces; ++i) {
+				for (unsigned int k = 0; k < 3u; ++k) {
+					paiMesh->mFaces[i].mIndices[k] = remap[indices[3 * static_cast<size_t>(i) + k]];
+				}
+			}
+
+			reorder_vertex_data(paiMesh->mVertices, remap);
+			reorder_vertex_data(paiMesh->mNormals, remap);
+			reorder_vertex_data(paiMesh->mTangents, remap);
+			reorder_vertex_data(paiMesh->mBitangents, remap);
+			for (unsigned int c = 0; c < AI_MAX_NUMBER_OF_COLOR_SETS; ++c) {
+				reorder_vertex_data(paiMesh->mColors[c], remap);
+			}
+			for (unsigned int t = 0; t < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++t) {
+				reorder_vertex_data(paiMesh->mTextureCoords[t], remap);
+			}
+			for (unsigned int b = 0; b < paiMesh->mNumBones; ++b) {
+				aiBone* paiBone = paiMesh->mBones[b];
+				for (unsigned int w = 0; w < paiBone->mNumWeights; ++w) {
+					paiBone->mWeights[w].mVertexId = remap[paiBone->mWeights[w].mVertexId];
+				}
+			}
+			for (unsigned int a = 0; a < paiMesh->mNumAnimMeshes; ++a) {
+				aiAnimMesh* paiAnimMesh = paiMesh->mAnimMeshes[a];
+				if (paiAnimMesh->mNumVertices != paiMesh->mNumVertices) {
+					continue;
+				}
+				reorder_vertex_data(paiAnimMesh->mVertices, remap);
+				reorder_vertex_data(paiAnimMesh->mNormals, remap);
+				reorder_vertex_data(paiAnimMesh->mTangents, remap);
+				reorder_vertex_data(paiAnimMesh->mBitangents, remap);
+				for (unsigned int c = 0; c < AI_MAX_NUMBER_OF_COLOR_SETS; ++c) {
+					reorder_vertex_data(paiAnimMesh->mColors[c], remap);
+				}
+				for (unsigned int t = 0; t < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++t) {
+					reorder_vertex_data(paiAnimMesh->mTextureCoords[t], remap);
+				}
+			}
+		});
+	}
+	
 	void model_t::initialize_materials()
 	{
 		auto n = static_cast<size_t>(mScene->mNumMeshes);
@@ -40,45 +125,56 @@ namespace gvk
 		}
 	}
 
-	aiNode* model_t::find_mesh_root_node(unsigned int aMeshIndexToFind) const
+	void model_t::initialize_node_table()
 	{
-		return mesh_node_traverser(aMeshIndexToFind, mScene->mRootNode);
-	}
-	
-	aiNode* model_t::mesh_node_traverser(unsigned int aMeshIndexToFind, aiNode* aNode) const
-	{
-		for (unsigned int i = 0; i < aNode->mNumMeshes; i++)
-		{
-			if (aNode->mMeshes[i] == aMeshIndexToFind) {
-				return aNode;
+		mNodes.clear();
+		mNodeIndexPerMesh.assign(static_cast<size_t>(mScene->mNumMeshes), std::optional<size_t>{});
+		if (nullptr == mScene->mRootNode) {
+			return;
+		}
+
+		// Traverse depth-first with an explicit stack (hierarchies of CAD models can be very deep). The global
+		// transforms are accumulated with Assimp's matrices, in the same order as a recursive traversal would:
+		std::vector<aiMatrix4x4> globalTransforms;
+		std::vector<std::tuple<const aiNode*, std::optional<size_t>>> stack;
+		stack.emplace_back(mScene->mRootNode, std::optional<size_t>{});
+		while (!stack.empty()) {
+			const auto [node, parentIndex] = stack.back();
+			stack.pop_back();
+
+			const size_t index = mNodes.size();
+			globalTransforms.push_back(parentIndex.has_value() ? globalTransforms[parentIndex.value()] * node->mTransformation : aiMatrix4x4{} * node->mTransformation);
+			mNodes.push_back(model_node{ node, parentIndex, to_mat4(node->mTransformation), to_mat4(globalTransforms.back()) });
+			for (unsigned int i = 0; i < node->mNumMeshes; ++i) {
+				auto& nodeIndex = mNodeIndexPerMesh[node->mMeshes[i]];
+				if (!nodeIndex.has_value()) {
+					nodeIndex = index;
+				}
 			}
-		}
-		// Not found => go deeper
-		for (unsigned int i = 0; i < aNode->mNumChildren; i++)
-		{
-			auto* node = mesh_node_traverser(aMeshIndexToFind, aNode->mChildren[i]);
-			if (nullptr != node) {
-				return node;
+
+			// Push the children in reverse order, s.t. they are visited in their original order:
+			for (unsigned int i = node->mNumChildren; i > 0; --i) {
+				stack.emplace_back(node->mChildren[i - 1], index);
 			}
 		}
-		return nullptr;
 	}
-	
-	std::optional<glm::mat4> model_t::transformation_matrix_traverser(unsigned int aMeshIndexToFind, const aiNode* aNode, const aiMatrix4x4& aM) const
+
+	std::optional<size_t> model_t::node_index_for_mesh(mesh_index_t aMeshIndex) const
 	{
-		aiMatrix4x4 nodeM = aM * aNode->mTransformation;
-		for (unsigned int i = 0; i < aNode->mNumMeshes; i++)
-		{
-			if (aNode->mMeshes[i] == aMeshIndexToFind) {
-				return to_mat4(nodeM);
-			}
-		}
-		// Not found => go deeper
-		for (unsigned int i = 0; i < aNode->mNumChildren; i++)
-		{
-			auto mat = transformation_matrix_traverser(aMeshIndexToFind, aNode->mChildren[i], nodeM);
-			if (mat.has_value()) {
-				return mat;
+		return mNodeIndexPerMesh[aMeshIndex];
+	}
+
+	aiNode* model_t::find_mesh_root_node(unsigned int aMeshIndexToFind) const
+	{
+		const auto nodeIndex = node_index_for_mesh(aMeshIndexToFind);
+		return nodeIndex.has_value() ? const_cast<aiNode*>(mNodes[nodeIndex.value()].mNode) : nullptr;
+	}
+
+	std::optional<size_t> model_t::find_node_index_by_name(const aiString& aName) const
+	{
+		for (size_t i = 0; i < mNodes.size(); ++i) {
+			if (mNodes[i].mNode->mName == aName) {
+				return i;
 			}
 		}
 		return {};
@@ -86,8 +182,11 @@ namespace gvk
 
 	glm::mat4 model_t::transformation_matrix_for_mesh(mesh_index_t aMeshIndex) const
 	{
-		// Find the mesh in Assim's node hierarchy
-		return transformation_matrix_traverser(static_cast<unsigned int>(aMeshIndex), mScene->mRootNode, aiMatrix4x4{}).value();
+		const auto nodeIndex = node_index_for_mesh(aMeshIndex);
+		if (!nodeIndex.has_value()) {
+			throw gvk::runtime_error(fmt::format("The mesh at index {} is not referenced by any node of the model.", aMeshIndex));
+		}
+		return mNodes[nodeIndex.value()].mGlobalTransform;
 	}
 
 	glm::mat4 model_t::mesh_root_matrix(mesh_index_t aMeshIndex) const
@@ -95,6 +194,77 @@ namespace gvk
 		return transformation_matrix_for_mesh(aMeshIndex);
 	}
 
+	void model_t::initialize_mesh_bounds()
+	{
+		// Only prepare the storage here; scanning all vertices during loading would be wasted effort whenever
+		// the bounds are not needed, e.g. when they are deserialized from a cache file (see get_mesh_bounds_cached).
+		const auto n = static_cast<size_t>(mScene->mNumMeshes);
+		mMeshBounds.assign(n, mesh_bounds{});
+		mTransformedMeshBounds.assign(n, mesh_bounds{});
+		mMeshBoundsOnceFlags = std::make_unique<std::once_flag[]>(n);
+		mOrientedBoundingBoxes.clear();
+	}
+
+	void model_t::compute_mesh_bounds(mesh_index_t aMeshIndex) const
+	{
+		const aiMesh* paiMesh = mScene->mMeshes[aMeshIndex];
+		std::vector<glm::vec3> positions(paiMesh->mNumVertices);
+		for (size_t v = 0; v < positions.size(); ++v) {
+			positions[v] = glm::vec3{ paiMesh->mVertices[v].x, paiMesh->mVertices[v].y, paiMesh->mVertices[v].z };
+		}
+		mMeshBounds[aMeshIndex] = bounds_of_points(positions);
+
+		const auto nodeIndex = node_index_for_mesh(aMeshIndex);
+		const auto& meshRootMatrix = nodeIndex.has_value() ? mNodes[nodeIndex.value()].mGlobalTransform : glm::mat4{ 1.0f };
+		if (glm::mat4{ 1.0f } == meshRootMatrix) {
+			mTransformedMeshBounds[aMeshIndex] = mMeshBounds[aMeshIndex];
+			return;
+		}
+		for (auto& p : positions) {
+			p = glm::vec3{ meshRootMatrix * glm::vec4{ p, 1.0f } };
+		}
+		mTransformedMeshBounds[aMeshIndex] = bounds_of_points(positions);
+	}
+
+	const mesh_bounds& model_t::bounds_for_mesh(mesh_index_t aMeshIndex) const
+	{
+		std::call_once(mMeshBoundsOnceFlags[aMeshIndex], &model_t::compute_mesh_bounds, this, aMeshIndex);
+		return mMeshBounds[aMeshIndex];
+	}
+
+	const mesh_bounds& model_t::transformed_bounds_for_mesh(mesh_index_t aMeshIndex) const
+	{
+		std::call_once(mMeshBoundsOnceFlags[aMeshIndex], &model_t::compute_mesh_bounds, this, aMeshIndex);
+		return mTransformedMeshBounds[aMeshIndex];
+	}
+
+	mesh_bounds model_t::transformed_bounds_for_meshes(const std::vector<mesh_index_t>& aMeshIndices) const
+	{
+		mesh_bounds result;
+		for (auto meshIndex : aMeshIndices) {
+			result = merged(result, transformed_bounds_for_mesh(meshIndex));
+		}
+		return result;
+	}
+
+	void model_t::compute_oriented_bounding_boxes()
+	{
+		const auto n = static_cast<size_t>(mScene->mNumMeshes);
+		mOrientedBoundingBoxes.resize(n);
+		for (size_t i = 0; i < n; ++i) {
+			const auto positions = positions_for_mesh(i);
+			mOrientedBoundingBoxes[i] = oriented_bounding_box_of_points(positions);
+		}
+	}
+
+	std::optional<oriented_bounding_box> model_t::oriented_bounding_box_for_mesh(mesh_index_t aMeshIndex) const
+	{
+		if (mOrientedBoundingBoxes.empty()) {
+			return {};
+		}
+		return mOrientedBoundingBoxes[aMeshIndex];
+	}
+
 	uint32_t model_t::num_actual_bones(mesh_index_t aMeshIndex) const
 	{
 		assert(mScene->mNumMeshes > aMeshIndex && 0 <= aMeshIndex);
@@ -482,100 +652,122 @@ namespace gvk
 		return result;
 	}
 
-	std::vector<glm::vec4> model_t::bone_weights_for_mesh(mesh_index_t aMeshIndex, bool aNormalizeBoneWeights) const
+	// The (up to) four most influential bones of one vertex, sorted descending by weight,
+	// and the sum of all of the vertex' bone weights, including the ones which did not make it into the top four:
+	struct top_bone_influences
+	{
+		std::array<float, 4> mWeights = { 0.0f, 0.0f, 0.0f, 0.0f };
+		std::array<uint32_t, 4> mBoneIndices = { 0u, 0u, 0u, 0u };
+		float mWeightsSum = 0.0f;
+	};
+
+	// Gathers the four most influential bones of each vertex of the given mesh in one pass over its bones.
+	// Every vertex gets a fixed-size slot, into which weights are inserted by insertion sort.
+	static std::vector<top_bone_influences> gather_top_bone_influences(const aiMesh* aMesh)
+	{
+		std::vector<top_bone_influences> result(aMesh->mNumVertices);
+		for (unsigned int j = 0; j < aMesh->mNumBones; j++) {
+			const aiBone* pBone = aMesh->mBones[j];
+			for (uint32_t b = 0; b < pBone->mNumWeights; b++) {
+				auto& slot = result[pBone->mWeights[b].mVertexId];
+				const float weight = pBone->mWeights[b].mWeight;
+				slot.mWeightsSum += weight;
+				if (weight <= slot.mWeights[3]) {
+					continue; // Not among the four most influential ones (so far)
+				}
+				// Shift lighter weights one position towards the end, and insert the new one:
+				int pos = 3;
+				for (; pos > 0 && weight > slot.mWeights[pos - 1]; --pos) {
+					slot.mWeights[pos] = slot.mWeights[pos - 1];
+					slot.mBoneIndices[pos] = slot.mBoneIndices[pos - 1];
+				}
+				slot.mWeights[pos] = weight;
+				slot.mBoneIndices[pos] = j;
+			}
+		}
+		return result;
+	}
+
+	void model_t::bone_weights_and_indices_for_mesh(mesh_index_t aMeshIndex, bool aNormalizeBoneWeights, uint32_t aBoneIndexOffset, std::vector<glm::vec4>* aBoneWeights, std::vector<glm::uvec4>* aBoneIndices) const
 	{
 		const aiMesh* paiMesh = mScene->mMeshes[aMeshIndex];
 		auto n = paiMesh->mNumVertices;
-		std::vector<glm::vec4> result;
-		result.reserve(n);
+		if (nullptr != aBoneWeights) {
+			aBoneWeights->reserve(aBoneWeights->size() + n);
+		}
+		if (nullptr != aBoneIndices) {
+			aBoneIndices->reserve(aBoneIndices->size() + n);
+		}
+
 		if (!paiMesh->HasBones()) {
-			LOG_WARNING(fmt::format("The mesh at index {} does not contain bones. Will return (1,0,0,0) bone weights for each vertex.", aMeshIndex));
-			for (decltype(n) i = 0; i < n; ++i) {
-				result.emplace_back(1.f, 0.f, 0.f, 0.f);
+			if (nullptr != aBoneWeights) {
+				LOG_WARNING(fmt::format("The mesh at index {} does not contain bones. Will return (1,0,0,0) bone weights for each vertex.", aMeshIndex));
+				aBoneWeights->insert(std::end(*aBoneWeights), n, glm::vec4{ 1.f, 0.f, 0.f, 0.f });
 			}
-		}
-		else {
-			// read bone indices and weights for bone animation
-			std::vector<std::vector<std::tuple<uint32_t, float>>> vTempWeightsPerVertex(paiMesh->mNumVertices);
-			for (unsigned int j = 0; j < paiMesh->mNumBones; j++) 
-			{
-				const aiBone* pBone = paiMesh->mBones[j];
-				for (uint32_t b = 0; b < pBone->mNumWeights; b++) 
-				{
-					vTempWeightsPerVertex[pBone->mWeights[b].mVertexId].emplace_back(j, pBone->mWeights[b].mWeight);
-				}
+			if (nullptr != aBoneIndices) {
+				const uint32_t fallbackIndex = aBoneIndexOffset;
+				LOG_WARNING(fmt::format("The mesh at index {} does not contain bones. Will return ({},{},{},{}) bone indices for each vertex.", aMeshIndex, fallbackIndex, fallbackIndex, fallbackIndex, fallbackIndex));
+				aBoneIndices->insert(std::end(*aBoneIndices), n, glm::uvec4{ fallbackIndex });
 			}
-			
-			// We've got bone weights. Proceed as planned.
-			bool hasNonNormalizedBoneWeights = false;
-			for (decltype(n) i = 0; i < n; ++i) {
-				// sort the current vertex' <bone id, weight> pairs descending by weight (so we can take the four most important ones)
-				std::sort(vTempWeightsPerVertex[i].begin(), vTempWeightsPerVertex[i].end(), [](std::tuple<uint32_t, float> a, std::tuple<uint32_t, float> b) { return std::get<float>(a) > std::get<float>(b); });
+			return;
+		}
 
-				auto& weights = result.emplace_back(0.0f, 0.0f, 0.0f, 0.0f);
-				const auto numIndexWeightPairs = std::min(int{ 4 }, static_cast<int>(vTempWeightsPerVertex[i].size()));
-				for (int j = 0; j < numIndexWeightPairs; ++j) {
-					weights[j] = std::get<float>(vTempWeightsPerVertex[i][j]);
-				}
+		// We've got bone weights. Proceed as planned.
+		const auto influences = gather_top_bone_influences(paiMesh);
+		bool hasNonNormalizedBoneWeights = false;
+		for (const auto& slot : influences) {
+			if (nullptr != aBoneWeights) {
+				auto& weights = aBoneWeights->emplace_back(slot.mWeights[0], slot.mWeights[1], slot.mWeights[2], slot.mWeights[3]);
 
 				// "normalize" the weights, if requested, so they add up to one
 				if (aNormalizeBoneWeights) {
 					// Blender can save meshes with a total weight sum > 1. So first scale down by the total sum (we need to consider all weights, not only the first four!)
-					float sum = 0.0f;
-					for (auto& w : vTempWeightsPerVertex[i]) {
-						sum += std::get<float>(w);
-					}
-					if (sum > 0.0f) {
-						weights /= sum;
+					if (slot.mWeightsSum > 0.0f) {
+						weights /= slot.mWeightsSum;
 					}
-					hasNonNormalizedBoneWeights = sum > 1.001f || hasNonNormalizedBoneWeights;
+					hasNonNormalizedBoneWeights = slot.mWeightsSum > 1.001f || hasNonNormalizedBoneWeights;
 					// if we have more than 4 weights, assign all the unconsidered ones to the 4th bone
 					weights.w = 1.0f - weights.x - weights.y - weights.z;
 				}
 			}
-			if (hasNonNormalizedBoneWeights) {
-				LOG_WARNING(fmt::format("The mesh at index {} contains non-normalized bone weights, adding up to more than 1.001.", aMeshIndex));
+			if (nullptr != aBoneIndices) {
+				// Unused slots refer to bone 0 (with weight 0):
+				aBoneIndices->emplace_back(slot.mBoneIndices[0] + aBoneIndexOffset, slot.mBoneIndices[1] + aBoneIndexOffset, slot.mBoneIndices[2] + aBoneIndexOffset, slot.mBoneIndices[3] + aBoneIndexOffset);
 			}
 		}
+		if (hasNonNormalizedBoneWeights) {
+			LOG_WARNING(fmt::format("The mesh at index {} contains non-normalized bone weights, adding up to more than 1.001.", aMeshIndex));
+		}
+	}
+
+	std::vector<glm::vec4> model_t::bone_weights_for_mesh(mesh_index_t aMeshIndex, bool aNormalizeBoneWeights) const
+	{
+		std::vector<glm::vec4> result;
+		bone_weights_and_indices_for_mesh(aMeshIndex, aNormalizeBoneWeights, 0u, &result, nullptr);
 		return result;
 	}
 
 	std::vector<glm::uvec4> model_t::bone_indices_for_mesh(mesh_index_t aMeshIndex, uint32_t aBoneIndexOffset) const
 	{
-		const aiMesh* paiMesh = mScene->mMeshes[aMeshIndex];
-		auto n = paiMesh->mNumVertices;
 		std::vector<glm::uvec4> result;
-		result.reserve(n);
-		if (!paiMesh->HasBones()) {
-			const uint32_t fallbackIndex = aBoneIndexOffset;
-			LOG_WARNING(fmt::format("The mesh at index {} does not contain bones. Will return ({},{},{},{}) bone indices for each vertex.", aMeshIndex, fallbackIndex, fallbackIndex, fallbackIndex, fallbackIndex));
-			for (decltype(n) i = 0; i < n; ++i) {
-				result.emplace_back(fallbackIndex, fallbackIndex, fallbackIndex, fallbackIndex);
-			}
-		}
-		else {
-			// read bone indices and weights for bone animation
-			std::vector<std::vector<std::tuple<uint32_t, float>>> vTempWeightsPerVertex(paiMesh->mNumVertices);
-			for (unsigned int j = 0; j < paiMesh->mNumBones; j++) 
-			{
-				const aiBone * pBone = paiMesh->mBones[j];
-				for (uint32_t b = 0; b < pBone->mNumWeights; b++) 
-				{
-					vTempWeightsPerVertex[pBone->mWeights[b].mVertexId].emplace_back(j, pBone->mWeights[b].mWeight);
-				}
-			}
-			
-			// We've got bone weights. Proceed as planned.
-			for (decltype(n) i = 0; i < n; ++i) {
-				// sort the current vertex' <bone id, weight> pairs descending by weight (so we can take the four most important ones)
-				std::sort(vTempWeightsPerVertex[i].begin(), vTempWeightsPerVertex[i].end(), [](std::tuple<uint32_t, float> a, std::tuple<uint32_t, float> b) { return std::get<float>(a) > std::get<float>(b); });
+		bone_weights_and_indices_for_mesh(aMeshIndex, false, aBoneIndexOffset, nullptr, &result);
+		return result;
+	}
 
-				auto& indices = result.emplace_back(aBoneIndexOffset, aBoneIndexOffset, aBoneIndexOffset, aBoneIndexOffset);
-				const auto numIndexWeightPairs = std::min(int{ 4 }, static_cast<int>(vTempWeightsPerVertex[i].size()));
-				for (int j = 0; j < numIndexWeightPairs; ++j) {
-					indices[j] = std::get<uint32_t>(vTempWeightsPerVertex[i][j]) + aBoneIndexOffset;
-				}
-			}
+	std::tuple<std::vector<glm::vec4>, std::vector<glm::uvec4>> model_t::bone_weights_and_indices_for_mesh(mesh_index_t aMeshIndex, bool aNormalizeBoneWeights, uint32_t aBoneIndexOffset) const
+	{
+		std::tuple<std::vector<glm::vec4>, std::vector<glm::uvec4>> result;
+		bone_weights_and_indices_for_mesh(aMeshIndex, aNormalizeBoneWeights, aBoneIndexOffset, &std::get<0>(result), &std::get<1>(result));
+		return result;
+	}
+
+	std::tuple<std::vector<glm::vec4>, std::vector<glm::uvec4>> model_t::bone_weights_and_indices_for_meshes_for_single_target_buffer(const std::vector<mesh_index_t>& aMeshIndices, bool aNormalizeBoneWeights, uint32_t aInitialBoneIndexOffset) const
+	{
+		std::tuple<std::vector<glm::vec4>, std::vector<glm::uvec4>> result;
+		uint32_t offset = aInitialBoneIndexOffset;
+		for (auto meshIndex : aMeshIndices) {
+			bone_weights_and_indices_for_mesh(meshIndex, aNormalizeBoneWeights, offset, &std::get<0>(result), &std::get<1>(result));
+			offset += num_bone_matrices(meshIndex);
 		}
 		return result;
 	}
@@ -624,6 +816,24 @@ namespace gvk
 		return static_cast<int>(indicesCount);
 	}
 
+	size_t model_t::number_of_vertices_for_meshes(const std::vector<mesh_index_t>& aMeshIndices) const
+	{
+		size_t result = 0;
+		for (auto meshIndex : aMeshIndices) {
+			result += number_of_vertices_for_mesh(meshIndex);
+		}
+		return result;
+	}
+
+	size_t model_t::number_of_indices_for_meshes(const std::vector<mesh_index_t>& aMeshIndices) const
+	{
+		size_t result = 0;
+		for (auto meshIndex : aMeshIndices) {
+			result += static_cast<size_t>(number_of_indices_for_mesh(meshIndex));
+		}
+		return result;
+	}
+
 	std::vector<mesh_index_t> model_t::select_all_meshes() const
 	{
 		std::vector<mesh_index_t> result;
@@ -635,23 +845,6 @@ namespace gvk
 		return result;
 	}
 
-	std::optional<glm::mat4> model_t::transformation_matrix_traverser_for_light(const aiLight* aLight, const aiNode* aNode, const aiMatrix4x4& aM) const
-	{
-		aiMatrix4x4 nodeM = aM * aNode->mTransformation;
-		if (aNode->mName == aLight->mName) {
-			return glm::transpose(glm::make_mat4(&nodeM.a1));
-		}
-		// Not found => go deeper
-		for (unsigned int i = 0; i < aNode->mNumChildren; i++)
-		{
-			auto mat = transformation_matrix_traverser_for_light(aLight, aNode->mChildren[i], nodeM);
-			if (mat.has_value()) {
-				return mat;
-			}
-		}
-		return {};
-	}
-
 	std::vector<glm::vec3> model_t::positions_for_meshes(std::vector<mesh_index_t> aMeshIndices) const
 	{
 		std::vector<glm::vec3> result;
@@ -729,7 +922,7 @@ namespace gvk
 		result.reserve(n);
 		for (decltype(n) i = 0; i < n; ++i) {
 			const aiLight* aiLight = mScene->mLights[i];
-			glm::mat4 transfo = transformation_matrix_traverser_for_light(aiLight, mScene->mRootNode, aiMatrix4x4()).value();
+			glm::mat4 transfo = mNodes[find_node_index_by_name(aiLight->mName).value()].mGlobalTransform;
 			glm::mat3 transfoForDirections = glm::mat3(glm::inverse(glm::transpose(transfo))); // TODO: inverse transpose okay for direction??
 			lightsource cgbLight;
 			cgbLight.mAngleInnerCone = aiLight->mAngleInnerCone;
@@ -791,7 +984,8 @@ namespace gvk
 			aiMatrix4x4 projMat;
 			aiCam->GetCameraMatrix(projMat);
 			cgbCam.set_projection_matrix(glm::make_mat4(&projMat.a1));
-			auto trafo = transformation_matrix_traverser_for_camera(aiCam, mScene->mRootNode, aiMatrix4x4());
+			const auto cameraNodeIndex = find_node_index_by_name(aiCam->mName);
+			const auto trafo = cameraNodeIndex.has_value() ? std::optional<glm::mat4>{ mNodes[cameraNodeIndex.value()].mGlobalTransform } : std::optional<glm::mat4>{};
 			if (trafo.has_value()) {
 				glm::vec3 side = glm::normalize(glm::cross(lookdir, updir));
 				cgbCam.set_translation(trafo.value() * glm::vec4(cgbCam.translation(), 1));
@@ -1182,28 +1376,55 @@ namespace gvk
 		return result;
 	}
 
-	std::optional<glm::mat4> model_t::transformation_matrix_traverser_for_camera(const aiCamera* aCamera, const aiNode* aNode, const aiMatrix4x4& aM) const
+	void model_t::add_all_to_node_map(std::unordered_map<std::string, aiNode*>& aNodeMap, aiNode* aNode)
 	{
-		aiMatrix4x4 nodeM = aM * aNode->mTransformation;
-		if (aNode->mName == aCamera->mName) {
-			return glm::transpose(glm::make_mat4(&nodeM.a1));
+		aNodeMap[to_string(aNode->mName)] = aNode;
+		for (unsigned int i = 0; i < aNode->mNumChildren; ++i) {
+			add_all_to_node_map(aNodeMap, aNode->mChildren[i]);
 		}
-		// Not found => go deeper
-		for (unsigned int i = 0; i < aNode->mNumChildren; i++)
-		{
-			auto mat = transformation_matrix_traverser_for_camera(aCamera, aNode->mChildren[i], nodeM);
-			if (mat.has_value()) {
-				return mat;
+	}
+
+	// Quantizes each vertex' weights to unsigned normalized integers of type T, s.t. they add up to exactly
+	// the maximum value of T. The rounding remainder goes to the weights with the largest fractional parts.
+	template <typename T>
+	static std::vector<glm::vec<4, T>> quantize_bone_weights(std::span<const glm::vec4> aBoneWeights)
+	{
+		constexpr uint32_t maxValue = std::numeric_limits<T>::max();
+		std::vector<glm::vec<4, T>> result;
+		result.reserve(aBoneWeights.size());
+		for (const auto& w : aBoneWeights) {
+			const glm::vec4 weights = glm::max(w, glm::vec4{ 0.0f });
+			const float sum = weights.x + weights.y + weights.z + weights.w;
+			if (sum <= 0.0f) {
+				result.emplace_back(static_cast<T>(maxValue), T{ 0 }, T{ 0 }, T{ 0 });
+				continue;
+			}
+			const glm::vec4 scaled = weights * (static_cast<float>(maxValue) / sum);
+			glm::uvec4 quantized = glm::min(glm::uvec4{ glm::floor(scaled) }, glm::uvec4{ maxValue });
+			uint32_t remainder = maxValue - std::min(maxValue, quantized.x + quantized.y + quantized.z + quantized.w);
+			glm::vec4 fractions = scaled - glm::floor(scaled);
+			for (; remainder > 0u; --remainder) {
+				int largest = 0;
+				for (int i = 1; i < 4; ++i) {
+					if (fractions[i] > fractions[largest]) {
+						largest = i;
+					}
+				}
+				++quantized[largest];
+				fractions[largest] = -1.0f;
 			}
+			result.emplace_back(static_cast<T>(quantized.x), static_cast<T>(quantized.y), static_cast<T>(quantized.z), static_cast<T>(quantized.w));
 		}
-		return {};
+		return result;
 	}
 
-	void model_t::add_all_to_node_map(std::unordered_map<std::string, aiNode*>& aNodeMap, aiNode* aNode)
+	std::vector<glm::u8vec4> quantize_bone_weights_unorm8(std::span<const glm::vec4> aBoneWeights)
 	{
-		aNodeMap[to_string(aNode->mName)] = aNode;
-		for (unsigned int i = 0; i < aNode->mNumChildren; ++i) {
-			add_all_to_node_map(aNodeMap, aNode->mChildren[i]);
-		}
+		return quantize_bone_weights<uint8_t>(aBoneWeights);
+	}
+
+	std::vector<glm::u16vec4> quantize_bone_weights_unorm16(std::span<const glm::vec4> aBoneWeights)
+	{
+		return quantize_bone_weights<uint16_t>(aBoneWeights);
 	}
 }
@@ -16,7 +16,24 @@ namespace gvk
 		return result;
 	}
 
-	avk::owning_resource<orca_scene_t> orca_scene_t::load_from_file(const std::string& aPath, model_t::aiProcessFlagsType aAssimpFlags)
+	mesh_bounds orca_scene_t::bounds_of_model(size_t aModelIndex) const
+	{
+		const auto& loadedModel = mModelData[aModelIndex].mLoadedModel;
+		return loadedModel->transformed_bounds_for_meshes(loadedModel->select_all_meshes());
+	}
+
+	std::vector<mesh_bounds> orca_scene_t::bounds_of_instances(size_t aModelIndex) const
+	{
+		const auto modelBounds = bounds_of_model(aModelIndex);
+		std::vector<mesh_bounds> result;
+		result.reserve(mModelData[aModelIndex].mInstances.size());
+		for (const auto& instance : mModelData[aModelIndex].mInstances) {
+			result.push_back(bounds_of_instance(modelBounds, instance));
+		}
+		return result;
+	}
+
+	avk::owning_resource<orca_scene_t> orca_scene_t::load_from_file(const std::string& aPath, model_t::aiProcessFlagsType aAssimpFlags, uint32_t aMaxThreads)
 	{
 		std::ifstream stream(aPath, std::ifstream::in);
 		if (!stream.good() || !stream || stream.fail())
@@ -149,12 +166,13 @@ namespace gvk
 			result.mPathsData.push_back(p);
 		}
 
-		// Load the models into memory:
+		// Load the models into memory. Every model gets its own Assimp::Importer, so they can be loaded in parallel:
 		auto fsceneBasePath = avk::extract_base_path(result.mLoadPath);
-		for (auto& modelData : result.mModelData) {
+		parallel_for(result.mModelData.size(), [&](size_t i) {
+			auto& modelData = result.mModelData[i];
 			modelData.mFullPathName = avk::combine_paths(fsceneBasePath, modelData.mFileName);
 			modelData.mLoadedModel = model_t::load_from_file(modelData.mFullPathName, aAssimpFlags);
-		}
+		}, aMaxThreads);
 		
 		return result;
 	}
@@ -0,0 +1,480 @@
+#include <gvk.hpp>
+
+namespace gvk
+{
+	// Subtrees with at most this many nodes are processed as (part of) one parallel task.
+	static constexpr uint32_t sNodesPerParallelTask = 1024u;
+
+	void scene_graph::reserve(size_t aNumNodes)
+	{
+		mDenseIndices.reserve(aNumNodes);
+		mParentIds.reserve(aNumNodes);
+		mNumChilds.reserve(aNumNodes);
+		mNodeIds.reserve(aNumNodes);
+		mParentIndices.reserve(aNumNodes);
+		mSubtreeSizes.reserve(aNumNodes);
+		mTranslations.reserve(aNumNodes);
+		mRotations.reserve(aNumNodes);
+		mScales.reserve(aNumNodes);
+		mLocalMatrices.reserve(aNumNodes);
+		mWorldMatrices.reserve(aNumNodes);
+		mModified.reserve(aNumNodes);
+		mWorldChanged.reserve(aNumNodes);
+	}
+
+	scene_node_id_t scene_graph::add_node(scene_node_id_t aParent, const glm::vec3& aTranslation, const glm::quat& aRotation, const glm::vec3& aScale)
+	{
+		if (sNoParent != aParent && aParent >= size()) {
+			throw gvk::logic_error(fmt::format("Invalid parent node id {} for a scene graph with {} nodes.", aParent, size()));
+		}
+		if (size() >= static_cast<size_t>(sNoParent)) {
+			throw gvk::runtime_error("The scene graph has reached its maximum number of nodes.");
+		}
+
+		const auto id = static_cast<scene_node_id_t>(size());
+		const auto index = static_cast<uint32_t>(mNodeIds.size());
+		mDenseIndices.push_back(index);
+		mParentIds.push_back(aParent);
+		mNumChilds.push_back(0u);
+		if (sNoParent != aParent) {
+			++mNumChilds[aParent];
+		}
+
+		// Append it to the contiguous arrays; the depth-first order is restored during the next update:
+		mNodeIds.push_back(id);
+		mParentIndices.push_back(sNoParent == aParent ? sNoParent : mDenseIndices[aParent]);
+		mSubtreeSizes.push_back(1u);
+		mTranslations.push_back(aTranslation);
+		mRotations.push_back(glm::normalize(aRotation));
+		mScales.push_back(aScale);
+		mLocalMatrices.emplace_back(1.0f);
+		mWorldMatrices.emplace_back(1.0f);
+		mModified.push_back(1u);
+		mWorldChanged.push_back(0u);
+
+		mOrderDirty = true;
+		mHasPendingChanges = true;
+		return id;
+	}
+
+	scene_node_id_t scene_graph::add_transform_hierarchy(transform& aRoot, scene_node_id_t aParent)
+	{
+		std::optional<scene_node_id_t> rootId;
+		// Depth-first traversal, where each stack entry holds a transform and the id of its parent's copy:
+		std::vector<std::tuple<transform*, scene_node_id_t>> stack;
+		stack.emplace_back(&aRoot, aParent);
+		while (!stack.empty()) {
+			auto [tf, parentId] = stack.back();
+			stack.pop_back();
+			const auto id = add_node(parentId, tf->translation(), tf->rotation(), tf->scale());
+			if (!rootId.has_value()) {
+				rootId = id;
+			}
+			// Push the childs in reverse order, s.t. they are added in their original order:
+			const auto& childs = tf->childs();
+			for (auto it = childs.rbegin(); it != childs.rend(); ++it) {
+				stack.emplace_back(it->get(), id);
+			}
+		}
+		return rootId.value();
+	}
+
+	std::vector<std::vector<scene_node_id_t>> scene_graph::add_orca_instances(const orca_scene_t& aScene, scene_node_id_t aParent)
+	{
+		size_t numInstances = 0;
+		for (const auto& modelData : aScene.models()) {
+			numInstances += modelData.mInstances.size();
+		}
+		reserve(size() + numInstances);
+
+		std::vector<std::vector<scene_node_id_t>> result;
+		result.reserve(aScene.models().size());
+		for (const auto& modelData : aScene.models()) {
+			auto& ids = result.emplace_back();
+			ids.reserve(modelData.mInstances.size());
+			for (const auto& instance : modelData.mInstances) {
+				ids.push_back(add_node(aParent, instance.mTranslation, glm::quat(instance.mRotation), instance.mScaling));
+			}
+		}
+		return result;
+	}
+
+	void scene_graph::set_parent(scene_node_id_t aNode, scene_node_id_t aParent)
+	{
+		if (aNode >= size() || (sNoParent != aParent && aParent >= size())) {
+			throw gvk::logic_error(fmt::format("Invalid node ids {} and {} for a scene graph with {} nodes.", aNode, aParent, size()));
+		}
+		if (mParentIds[aNode] == aParent) {
+			return;
+		}
+		for (auto ancestor = aParent; sNoParent != ancestor; ancestor = mParentIds[ancestor]) {
+			if (ancestor == aNode) {
+				throw gvk::logic_error(fmt::format("Node {} can not be attached to node {}, because that is part of its own subtree.", aNode, aParent));
+			}
+		}
+
+		if (sNoParent != mParentIds[aNode]) {
+			--mNumChilds[mParentIds[aNode]];
+		}
+		mParentIds[aNode] = aParent;
+		if (sNoParent != aParent) {
+			++mNumChilds[aParent];
+		}
+		mOrderDirty = true;
+		mark_modified(aNode);
+	}
+
+	void scene_graph::mark_modified(scene_node_id_t aNode)
+	{
+		mModified[mDenseIndices[aNode]] = 1u;
+		mHasPendingChanges = true;
+	}
+
+	void scene_graph::set_translation(scene_node_id_t aNode, const glm::vec3& aTranslation)
+	{
+		mTranslations[mDenseIndices[aNode]] = aTranslation;
+		mark_modified(aNode);
+	}
+
+	void scene_graph::set_rotation(scene_node_id_t aNode, const glm::quat& aRotation)
+	{
+		mRotations[mDenseIndices[aNode]] = glm::normalize(aRotation);
+		mark_modified(aNode);
+	}
+
+	void scene_graph::set_scale(scene_node_id_t aNode, const glm::vec3& aScale)
+	{
+		mScales[mDenseIndices[aNode]] = aScale;
+		mark_modified(aNode);
+	}
+
+	glm::mat4 scene_graph::local_matrix(scene_node_id_t aNode) const
+	{
+		const auto index = mDenseIndices[aNode];
+		glm::mat4 result;
+		compose_affine_transforms(&mTranslations[index], &mRotations[index], &mScales[index], &result, 1);
+		return result;
+	}
+
+	glm::mat4 scene_graph::current_world_matrix(scene_node_id_t aNode) const
+	{
+		if (!mHasPendingChanges) {
+			return mWorldMatrices[mDenseIndices[aNode]];
+		}
+		// Go up the parent chain via the node ids, which are up to date even if the order is not:
+		glm::mat4 result = local_matrix(aNode);
+		for (auto ancestor = mParentIds[aNode]; sNoParent != ancestor; ancestor = mParentIds[ancestor]) {
+			result = multiply_affine(local_matrix(ancestor), result);
+		}
+		return result;
+	}
+
+	void scene_graph::rebuild_order()
+	{
+		const auto n = static_cast<uint32_t>(size());
+
+		// Gather the childs of every node (in id order) via a counting sort:
+		std::vector<uint32_t> childOffsets(n + 1, 0u);
+		std::vector<scene_node_id_t> roots;
+		for (scene_node_id_t id = 0; id < n; ++id) {
+			childOffsets[id + 1] = childOffsets[id] + mNumChilds[id];
+		}
+		std::vector<scene_node_id_t> childIds(childOffsets[n]);
+		{
+			std::vector<uint32_t> writePos(std::begin(childOffsets), std::end(childOffsets) - 1);
+			for (scene_node_id_t id = 0; id < n; ++id) {
+				if (sNoParent == mParentIds[id]) {
+					roots.push_back(id);
+				}
+				else {
+					childIds[writePos[mParentIds[id]]++] = id;
+				}
+			}
+		}
+
+		// Depth-first (pre-)order:
+		std::vector<scene_node_id_t> order;
+		order.reserve(n);
+		std::vector<scene_node_id_t> stack(roots.rbegin(), roots.rend());
+		while (!stack.empty()) {
+			const auto id = stack.back();
+			stack.pop_back();
+			order.push_back(id);
+			for (auto c = childOffsets[id + 1]; c > childOffsets[id]; --c) {
+				stack.push_back(childIds[c - 1]);
+			}
+		}
+		assert(order.size() == n);
+
+		// Bring the per-node data into that order:
+		auto permute = [&order, this](auto& aData) {
+			std::remove_reference_t<decltype(aData)> permuted;
+			permuted.reserve(aData.capacity());
+			for (auto id : order) {
+				permuted.push_back(aData[mDenseIndices[id]]);
+			}
+			aData = std::move(permuted);
+		};
+		permute(mTranslations);
+		permute(mRotations);
+		permute(mScales);
+		permute(mLocalMatrices);
+		permute(mWorldMatrices);
+		permute(mModified);
+		for (uint32_t i = 0; i < n; ++i) {
+			mDenseIndices[order[i]] = i;
+		}
+		mNodeIds = std::move(order);
+		for (uint32_t i = 0; i < n; ++i) {
+			const auto parentId = mParentIds[mNodeIds[i]];
+			mParentIndices[i] = sNoParent == parentId ? sNoParent : mDenseIndices[parentId];
+		}
+
+		// Accumulate the subtree sizes from the back, where every node comes after its parent:
+		std::fill(std::begin(mSubtreeSizes), std::end(mSubtreeSizes), 1u);
+		for (uint32_t i = n; i > 0; --i) {
+			if (sNoParent != mParentIndices[i - 1]) {
+				mSubtreeSizes[mParentIndices[i - 1]] += mSubtreeSizes[i - 1];
+			}
+		}
+
+		// Split the nodes into the ones which are processed serially and ranges of small subtrees which are processed
+		// in parallel. Ancestors of large subtrees have even larger subtrees => they are all processed serially before.
+		mSerialNodes.clear();
+		mParallelRanges.clear();
+		for (uint32_t i = 0; i < n; ) {
+			if (mSubtreeSizes[i] > sNodesPerParallelTask) {
+				mSerialNodes.push_back(i);
+				++i;
+				continue;
+			}
+			const auto end = i + mSubtreeSizes[i];
+			if (!mParallelRanges.empty() && mParallelRanges.back().second == i && end - mParallelRanges.back().first <= sNodesPerParallelTask) {
+				mParallelRanges.back().second = end; // Merge adjacent small subtrees
+			}
+			else {
+				mParallelRanges.emplace_back(i, end);
+			}
+			i = end;
+		}
+
+		mOrderDirty = false;
+	}
+
+	void scene_graph::update_range(uint32_t aBegin, uint32_t aEnd)
+	{
+		// Compose the local matrices of consecutive runs of modified nodes in batches:
+		for (uint32_t i = aBegin; i < aEnd; ) {
+			if (0u == mModified[i]) {
+				++i;
+				continue;
+			}
+			auto runEnd = i + 1;
+			while (runEnd < aEnd && 0u != mModified[runEnd]) {
+				++runEnd;
+			}
+			compose_affine_transforms(&mTranslations[i], &mRotations[i], &mScales[i], &mLocalMatrices[i], runEnd - i);
+			i = runEnd;
+		}
+
+		// Every node comes after its parent => a node's parent has already been processed:
+		for (uint32_t i = aBegin; i < aEnd; ++i) {
+			const auto parent = mParentIndices[i];
+			if (sNoParent == parent) {
+				mWorldChanged[i] = mModified[i];
+				if (0u != mModified[i]) {
+					mWorldMatrices[i] = mLocalMatrices[i];
+				}
+			}
+			else {
+				mWorldChanged[i] = mModified[i] | mWorldChanged[parent];
+				if (0u != mWorldChanged[i]) {
+					mWorldMatrices[i] = multiply_affine(mWorldMatrices[parent], mLocalMatrices[i]);
+				}
+			}
+			mModified[i] = 0u;
+		}
+	}
+
+	void scene_graph::update_world_matrices(uint32_t aMaxThreads)
+	{
+		if (!mHasPendingChanges) {
+			return;
+		}
+		if (mOrderDirty) {
+			rebuild_order();
+		}
+
+		const auto numThreads = 0u == aMaxThreads ? max_worker_threads() : aMaxThreads;
+		if (numThreads <= 1u || mParallelRanges.size() <= 1) {
+			update_range(0u, static_cast<uint32_t>(mNodeIds.size()));
+		}
+		else {
+			for (auto i : mSerialNodes) {
+				update_range(i, i + 1);
+			}
+			parallel_for(mParallelRanges.size(), [this](size_t aRange) {
+				update_range(mParallelRanges[aRange].first, mParallelRanges[aRange].second);
+			}, numThreads);
+		}
+
+		mHasPendingChanges = false;
+	}
+
+	void scene_graph_node::set_translation(const glm::vec3& pValue)
+	{
+		mGraph->set_translation(mId, pValue);
+	}
+
+	void scene_graph_node::set_rotation(const glm::quat& pValue)
+	{
+		mGraph->set_rotation(mId, pValue);
+	}
+
+	void scene_graph_node::set_scale(const glm::vec3& pValue)
+	{
+		mGraph->set_scale(mId, pValue);
+	}
+
+	glm::mat4 scene_graph_node::local_transformation_matrix() const
+	{
+		return mGraph->local_matrix(mId);
+	}
+
+	glm::mat4 scene_graph_node::inverse_local_transformation_matrix() const
+	{
+		return inverse_affine(local_transformation_matrix());
+	}
+
+	glm::mat4 scene_graph_node::global_transformation_matrix() const
+	{
+		return mGraph->current_world_matrix(mId);
+	}
+
+	glm::mat4 scene_graph_node::inverse_global_transformation_matrix() const
+	{
+		return inverse_affine(global_transformation_matrix());
+	}
+
+	glm::vec3 scene_graph_node::translation() const
+	{
+		return mGraph->translation(mId);
+	}
+
+	glm::quat scene_graph_node::rotation() const
+	{
+		return mGraph->rotation(mId);
+	}
+
+	glm::vec3 scene_graph_node::scale() const
+	{
+		return mGraph->scale(mId);
+	}
+
+	void scene_graph_node::look_at(const glm::vec3& aPosition)
+	{
+		auto dir = aPosition - translation();
+		if (glm::dot(dir, dir) <= std::numeric_limits<float>::epsilon()) {
+			return;
+		}
+		look_along(dir);
+	}
+
+	void scene_graph_node::look_along(const glm::vec3& aDirection)
+	{
+		if (glm::dot(aDirection, aDirection) < std::numeric_limits<float>::epsilon()) {
+			LOG_DEBUG("Direction vector passed to scene_graph_node::look_along has (almost) zero length.");
+			return;
+		}
+		// Same orientation as transform::look_along:
+		set_rotation(glm::normalize(glm::quatLookAt(glm::normalize(aDirection), glm::vec3{0.f, 1.f, 0.f})));
+	}
+
+	bool scene_graph_node::has_parent() const
+	{
+		return scene_graph::sNoParent != mGraph->parent(mId);
+	}
+
+	bool scene_graph_node::has_childs() const
+	{
+		return mGraph->number_of_childs(mId) > 0;
+	}
+
+	scene_graph_node scene_graph_node::parent() const
+	{
+		const auto parentId = mGraph->parent(mId);
+		return scene_graph::sNoParent == parentId ? scene_graph_node{} : scene_graph_node{ *mGraph, parentId };
+	}
+
+	void attach_transform(scene_graph_node pParent, scene_graph_node pChild)
+	{
+		assert(pParent);
+		assert(pChild);
+		if (&pParent.graph() != &pChild.graph()) {
+			throw gvk::logic_error("Nodes of different scene graphs can not be attached to each other.");
+		}
+		pChild.graph().set_parent(pChild.id(), pParent.id());
+	}
+
+	void detach_transform(scene_graph_node pParent, scene_graph_node pChild)
+	{
+		assert(pParent);
+		assert(pChild);
+		if (pChild.parent() != pParent) {
+			return;
+		}
+		pChild.graph().set_parent(pChild.id(), scene_graph::sNoParent);
+	}
+
+	// Same as the *_wrt functions for transforms:
+	static glm::vec3 direction_wrt(const scene_graph_node& pNode, const glm::vec3& pDirection, const glm::mat4& pReference)
+	{
+		const glm::mat4 invTrSpace = glm::inverse(pReference * pNode.global_transformation_matrix());
+		return invTrSpace * glm::vec4(pDirection, 1.0f);
+	}
+
+	glm::vec3 front_wrt(const scene_graph_node& pNode, glm::mat4 pReference)
+	{
+		return direction_wrt(pNode, gvk::front(pNode), pReference);
+	}
+
+	glm::vec3 back_wrt(const scene_graph_node& pNode, glm::mat4 pReference)
+	{
+		return direction_wrt(pNode, gvk::back(pNode), pReference);
+	}
+
+	glm::vec3 right_wrt(const scene_graph_node& pNode, glm::mat4 pReference)
+	{
+		return direction_wrt(pNode, gvk::right(pNode), pReference);
+	}
+
+	glm::vec3 left_wrt(const scene_graph_node& pNode, glm::mat4 pReference)
+	{
+		return direction_wrt(pNode, gvk::left(pNode), pReference);
+	}
+
+	glm::vec3 up_wrt(const scene_graph_node& pNode, glm::mat4 pReference)
+	{
+		return direction_wrt(pNode, gvk::up(pNode), pReference);
+	}
+
+	glm::vec3 down_wrt(const scene_graph_node& pNode, glm::mat4 pReference)
+	{
+		return direction_wrt(pNode, gvk::down(pNode), pReference);
+	}
+
+	void translate(scene_graph_node pNode, const glm::vec3& pTranslation)
+	{
+		pNode.set_translation(pNode.translation() + pTranslation);
+	}
+
+	void rotate(scene_graph_node pNode, const glm::quat& pRotation)
+	{
+		pNode.set_rotation(pRotation * pNode.rotation());
+	}
+
+	void scale(scene_graph_node pNode, const glm::vec3& pScale)
+	{
+		pNode.set_scale(pNode.scale() * pScale);
+	}
+}
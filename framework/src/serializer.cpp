@@ -0,0 +1,429 @@
+#include <gvk.hpp>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace gvk
+{
+	static inline uint64_t align_cache_file_offset(uint64_t aOffset, uint64_t aAlignment)
+	{
+		return (aOffset + aAlignment - 1) / aAlignment * aAlignment;
+	}
+
+	uint64_t xxhash64(const void* aData, size_t aSize, uint64_t aSeed)
+	{
+		constexpr uint64_t P1 = 11400714785074694791ull;
+		constexpr uint64_t P2 = 14029467366897019727ull;
+		constexpr uint64_t P3 = 1609587929392839161ull;
+		constexpr uint64_t P4 = 9650029242287828579ull;
+		constexpr uint64_t P5 = 2870177450012600261ull;
+		auto rotl = [](uint64_t x, int r) { return (x << r) | (x >> (64 - r)); };
+		auto read64 = [](const uint8_t* p) { uint64_t v; std::memcpy(&v, p, sizeof(v)); return v; };
+		auto read32 = [](const uint8_t* p) { uint32_t v; std::memcpy(&v, p, sizeof(v)); return v; };
+		auto round = [&](uint64_t acc, uint64_t input) { acc += input * P2; acc = rotl(acc, 31); return acc * P1; };
+		auto merge = [&](uint64_t acc, uint64_t val) { acc ^= round(0, val); return acc * P1 + P4; };
+
+		const auto* p = static_cast<const uint8_t*>(aData);
+		const auto* end = p + aSize;
+		uint64_t h;
+		if (aSize >= 32) {
+			uint64_t v1 = aSeed + P1 + P2;
+			uint64_t v2 = aSeed + P2;
+			uint64_t v3 = aSeed;
+			uint64_t v4 = aSeed - P1;
+			const auto* limit = end - 32;
+			do {
+				v1 = round(v1, read64(p)); p += 8;
+				v2 = round(v2, read64(p)); p += 8;
+				v3 = round(v3, read64(p)); p += 8;
+				v4 = round(v4, read64(p)); p += 8;
+			} while (p <= limit);
+			h = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+			h = merge(h, v1);
+			h = merge(h, v2);
+			h = merge(h, v3);
+			h = merge(h, v4);
+		}
+		else {
+			h = aSeed + P5;
+		}
+		h += static_cast<uint64_t>(aSize);
+
+		while (p + 8 <= end) {
+			h ^= round(0, read64(p));
+			h = rotl(h, 27) * P1 + P4;
+			p += 8;
+		}
+		if (p + 4 <= end) {
+			h ^= static_cast<uint64_t>(read32(p)) * P1;
+			h = rotl(h, 23) * P2 + P3;
+			p += 4;
+		}
+		while (p < end) {
+			h ^= static_cast<uint64_t>(*p) * P5;
+			h = rotl(h, 11) * P1;
+			++p;
+		}
+
+		h ^= h >> 33;
+		h *= P2;
+		h ^= h >> 29;
+		h *= P3;
+		h ^= h >> 32;
+		return h;
+	}
+
+	static int64_t get_modification_time(const std::string_view aPath)
+	{
+		return static_cast<int64_t>(std::filesystem::last_write_time(aPath).time_since_epoch().count());
+	}
+
+	cache_source_file_info get_cache_source_file_info(const std::string_view aPath)
+	{
+		cache_source_file_info result;
+		result.mPath = std::string(aPath);
+		result.mModificationTime = get_modification_time(aPath);
+		memory_mapped_file file(aPath);
+		result.mSize = static_cast<uint64_t>(file.size());
+		result.mHash = xxhash64(file.data(), file.size());
+		return result;
+	}
+
+	static std::optional<cache_file_header> read_cache_file_header(const std::byte* aData, size_t aSize)
+	{
+		if (aSize < sizeof(cache_file_header)) {
+			return {};
+		}
+		cache_file_header header;
+		std::memcpy(&header, aData, sizeof(cache_file_header));
+		if (header.mMagic != cache_file_header::sMagic
+			|| header.mFormatVersion != cache_file_header::sFormatVersion
+			|| header.mBlobAlignment != cache_file_header::sBlobAlignment
+			|| header.mTocOffset < sizeof(cache_file_header)
+			|| header.mTocOffset + header.mTocCount * sizeof(cache_file_toc_entry) > aSize
+			|| header.mSourceFilesOffset < header.mTocOffset + header.mTocCount * sizeof(cache_file_toc_entry)
+			|| header.mSourceFilesOffset > aSize) {
+			return {};
+		}
+		return header;
+	}
+
+	static std::optional<std::vector<cache_source_file_info>> read_cache_source_files(const std::byte* aData, size_t aSize, const cache_file_header& aHeader)
+	{
+		std::vector<cache_source_file_info> result;
+		result.reserve(static_cast<size_t>(aHeader.mSourceFilesCount));
+		auto offset = static_cast<size_t>(aHeader.mSourceFilesOffset);
+		auto read = [&](void* aDst, size_t aNumBytes) {
+			if (offset + aNumBytes > aSize) {
+				return false;
+			}
+			std::memcpy(aDst, aData + offset, aNumBytes);
+			offset += aNumBytes;
+			return true;
+		};
+		for (uint64_t i = 0; i < aHeader.mSourceFilesCount; ++i) {
+			auto& info = result.emplace_back();
+			uint64_t pathLength;
+			if (!read(&info.mSize, sizeof(info.mSize)) || !read(&info.mModificationTime, sizeof(info.mModificationTime)) || !read(&info.mHash, sizeof(info.mHash)) || !read(&pathLength, sizeof(pathLength))) {
+				return {};
+			}
+			info.mPath.resize(static_cast<size_t>(pathLength));
+			if (!read(info.mPath.data(), info.mPath.size())) {
+				return {};
+			}
+		}
+		return result;
+	}
+
+	static std::optional<std::vector<cache_source_file_info>> read_cache_source_files(const std::string_view aPath, cache_file_header& aHeader)
+	{
+		memory_mapped_file file(aPath);
+		auto header = read_cache_file_header(file.data(), file.size());
+		if (!header.has_value()) {
+			return {};
+		}
+		aHeader = header.value();
+		return read_cache_source_files(file.data(), file.size(), aHeader);
+	}
+
+	bool is_cache_file_compatible(const std::string_view aPath)
+	{
+		std::ifstream stream(std::string(aPath), std::ios::binary);
+		if (!stream) {
+			return false;
+		}
+		std::array<std::byte, sizeof(cache_file_header)> headerData;
+		stream.read(reinterpret_cast<char*>(headerData.data()), headerData.size());
+		if (stream.gcount() != static_cast<std::streamsize>(headerData.size())) {
+			return false;
+		}
+		std::error_code ec;
+		const auto fileSize = std::filesystem::file_size(aPath, ec);
+		if (ec) {
+			return false;
+		}
+		return read_cache_file_header(headerData.data(), static_cast<size_t>(fileSize)).has_value();
+	}
+
+	std::vector<std::string> stale_source_files_of_cache_file(const std::string_view aPath)
+	{
+		cache_file_header header;
+		auto sourceFiles = read_cache_source_files(aPath, header);
+		if (!sourceFiles.has_value()) {
+			throw gvk::runtime_error(fmt::format("The cache file '{}' is incomplete or has been written in an incompatible format.", aPath));
+		}
+
+		std::vector<std::string> result;
+		for (const auto& recorded : sourceFiles.value()) {
+			std::error_code ec;
+			const auto size = std::filesystem::file_size(recorded.mPath, ec);
+			if (ec || static_cast<uint64_t>(size) != recorded.mSize) {
+				result.push_back(recorded.mPath);
+				continue;
+			}
+			if (get_modification_time(recorded.mPath) == recorded.mModificationTime) {
+				continue;
+			}
+			// The file has been touched, but maybe not modified => compare the contents' hashes:
+			if (get_cache_source_file_info(recorded.mPath).mHash != recorded.mHash) {
+				result.push_back(recorded.mPath);
+			}
+		}
+		return result;
+	}
+
+	bool is_cache_file_up_to_date(const std::string_view aPath, std::optional<unsigned int> aAssimpFlags, std::optional<bool> aCompressTextures)
+	{
+		if (!does_cache_file_exist(aPath)) {
+			return false;
+		}
+		if (!is_cache_file_compatible(aPath)) {
+			LOG_INFO(fmt::format("The cache file '{}' is incomplete or has been written in an incompatible format. It is going to be rebuilt.", aPath));
+			return false;
+		}
+		cache_file_header header;
+		if (!read_cache_source_files(aPath, header).has_value()) {
+			LOG_INFO(fmt::format("The cache file '{}' contains an invalid list of source files. It is going to be rebuilt.", aPath));
+			return false;
+		}
+		if (aAssimpFlags.has_value() && (0u == header.mHasAssimpFlags || header.mAssimpFlags != aAssimpFlags.value())) {
+			LOG_INFO(fmt::format("The cache file '{}' has been written with different Assimp flags. It is going to be rebuilt.", aPath));
+			return false;
+		}
+		if (aCompressTextures.has_value() && (0u == header.mHasCompressTextures || (0u != header.mCompressTextures) != aCompressTextures.value())) {
+			LOG_INFO(fmt::format("The cache file '{}' has been written with a different texture compression setting. It is going to be rebuilt.", aPath));
+			return false;
+		}
+		auto staleFiles = stale_source_files_of_cache_file(aPath);
+		if (!staleFiles.empty()) {
+			std::string list;
+			for (const auto& f : staleFiles) {
+				list += fmt::format("\n    {}", f);
+			}
+			LOG_INFO(fmt::format("The following source files of cache file '{}' have changed, it is going to be rebuilt:{}", aPath, list));
+			return false;
+		}
+		return true;
+	}
+
+#pragma region memory_mapped_file
+	memory_mapped_file::memory_mapped_file(const std::string_view aPath)
+	{
+		const std::string path(aPath);
+#ifdef _WIN32
+		mFile = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (INVALID_HANDLE_VALUE == mFile) {
+			throw gvk::runtime_error(fmt::format("Unable to open file '{}' for memory mapping.", path));
+		}
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(mFile, &fileSize)) {
+			CloseHandle(mFile);
+			throw gvk::runtime_error(fmt::format("Unable to determine the size of file '{}'.", path));
+		}
+		mSize = static_cast<size_t>(fileSize.QuadPart);
+		if (0 == mSize) {
+			return;
+		}
+		mMapping = CreateFileMappingA(mFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (nullptr == mMapping) {
+			CloseHandle(mFile);
+			throw gvk::runtime_error(fmt::format("Unable to create a file mapping for '{}'.", path));
+		}
+		mData = static_cast<const std::byte*>(MapViewOfFile(mMapping, FILE_MAP_READ, 0, 0, 0));
+		if (nullptr == mData) {
+			CloseHandle(mMapping);
+			CloseHandle(mFile);
+			throw gvk::runtime_error(fmt::format("Unable to map a view of file '{}'.", path));
+		}
+#else
+		mFile = open(path.c_str(), O_RDONLY);
+		if (-1 == mFile) {
+			throw gvk::runtime_error(fmt::format("Unable to open file '{}' for memory mapping.", path));
+		}
+		struct stat fileStat;
+		if (0 != fstat(mFile, &fileStat)) {
+			close(mFile);
+			throw gvk::runtime_error(fmt::format("Unable to determine the size of file '{}'.", path));
+		}
+		mSize = static_cast<size_t>(fileStat.st_size);
+		if (0 == mSize) {
+			return;
+		}
+		void* mapped = mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, mFile, 0);
+		if (MAP_FAILED == mapped) {
+			close(mFile);
+			throw gvk::runtime_error(fmt::format("Unable to memory map file '{}'.", path));
+		}
+		mData = static_cast<const std::byte*>(mapped);
+#endif
+	}
+
+	memory_mapped_file::~memory_mapped_file()
+	{
+#ifdef _WIN32
+		if (nullptr != mData) {
+			UnmapViewOfFile(mData);
+		}
+		if (nullptr != mMapping) {
+			CloseHandle(mMapping);
+		}
+		if (INVALID_HANDLE_VALUE != mFile) {
+			CloseHandle(mFile);
+		}
+#else
+		if (nullptr != mData) {
+			munmap(const_cast<std::byte*>(mData), mSize);
+		}
+		if (-1 != mFile) {
+			close(mFile);
+		}
+#endif
+	}
+#pragma endregion
+
+#pragma region serializer::serialize
+	serializer::serialize::state::state(const std::string_view aCacheFilePath) :
+		mOfstream(std::string(aCacheFilePath), std::ios::binary | std::ios::trunc),
+		mArchive(mOfstream),
+		mUncaughtExceptions(std::uncaught_exceptions())
+	{
+		if (!mOfstream) {
+			throw gvk::runtime_error(fmt::format("Unable to open cache file '{}' for writing.", aCacheFilePath));
+		}
+		// Reserve space for the header. It is written with a valid magic number only once everything else has been written.
+		const cache_file_header placeholder{};
+		mOfstream.write(reinterpret_cast<const char*>(&placeholder), sizeof(placeholder));
+	}
+
+	serializer::serialize::state::~state()
+	{
+		if (std::uncaught_exceptions() > mUncaughtExceptions) {
+			// Destroyed during stack unwinding => the archived data is incomplete. Leave the placeholder header in place, s.t. the file is rebuilt the next time.
+			LOG_WARNING("Writing the cache file has been aborted by an exception. It will be rebuilt the next time.");
+			return;
+		}
+		if (!mOfstream) {
+			LOG_ERROR("Writing the cache file failed. It will be rebuilt the next time.");
+			return;
+		}
+
+		// Write the table of contents after the archived data, then the header at the beginning of the file:
+		cache_file_header header{};
+		header.mMagic = cache_file_header::sMagic;
+		header.mFormatVersion = cache_file_header::sFormatVersion;
+		header.mBlobAlignment = cache_file_header::sBlobAlignment;
+
+		const auto dataEnd = static_cast<uint64_t>(mOfstream.tellp());
+		header.mTocOffset = align_cache_file_offset(dataEnd, alignof(cache_file_toc_entry));
+		header.mTocCount = static_cast<uint64_t>(mToc.size());
+		const std::array<char, alignof(cache_file_toc_entry)> padding{};
+		mOfstream.write(padding.data(), static_cast<std::streamsize>(header.mTocOffset - dataEnd));
+		mOfstream.write(reinterpret_cast<const char*>(mToc.data()), static_cast<std::streamsize>(mToc.size() * sizeof(cache_file_toc_entry)));
+
+		// Then the list of source files:
+		header.mSourceFilesOffset = static_cast<uint64_t>(mOfstream.tellp());
+		header.mSourceFilesCount = static_cast<uint64_t>(mSourceFiles.size());
+		for (const auto& info : mSourceFiles) {
+			const auto pathLength = static_cast<uint64_t>(info.mPath.size());
+			mOfstream.write(reinterpret_cast<const char*>(&info.mSize), sizeof(info.mSize));
+			mOfstream.write(reinterpret_cast<const char*>(&info.mModificationTime), sizeof(info.mModificationTime));
+			mOfstream.write(reinterpret_cast<const char*>(&info.mHash), sizeof(info.mHash));
+			mOfstream.write(reinterpret_cast<const char*>(&pathLength), sizeof(pathLength));
+			mOfstream.write(info.mPath.data(), static_cast<std::streamsize>(info.mPath.size()));
+		}
+		header.mHasAssimpFlags = mAssimpFlags.has_value() ? 1u : 0u;
+		header.mAssimpFlags = mAssimpFlags.value_or(0u);
+		header.mHasCompressTextures = mCompressTextures.has_value() ? 1u : 0u;
+		header.mCompressTextures = mCompressTextures.value_or(false) ? 1u : 0u;
+
+		mOfstream.seekp(0);
+		mOfstream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		mOfstream.flush();
+		if (!mOfstream) {
+			LOG_ERROR("Writing the cache file failed. It will be rebuilt the next time.");
+		}
+	}
+
+	void serializer::serialize::write_blob(const void* aData, size_t aSize)
+	{
+		auto& stream = mState->mOfstream;
+		const auto currentOffset = static_cast<uint64_t>(stream.tellp());
+		const auto blobOffset = align_cache_file_offset(currentOffset, cache_file_header::sBlobAlignment);
+		const std::array<char, cache_file_header::sBlobAlignment> padding{};
+		stream.write(padding.data(), static_cast<std::streamsize>(blobOffset - currentOffset));
+		stream.write(static_cast<const char*>(aData), static_cast<std::streamsize>(aSize));
+		mState->mToc.push_back(cache_file_toc_entry{ blobOffset, static_cast<uint64_t>(aSize) });
+	}
+	void serializer::serialize::add_source_file(const std::string_view aPath)
+	{
+		auto& sourceFiles = mState->mSourceFiles;
+		if (std::any_of(std::begin(sourceFiles), std::end(sourceFiles), [aPath](const cache_source_file_info& bInfo) { return bInfo.mPath == aPath; })) {
+			return;
+		}
+		sourceFiles.push_back(get_cache_source_file_info(aPath));
+	}
+#pragma endregion
+
+#pragma region serializer::deserialize
+	static const cache_file_header* validated_cache_file_header(const memory_mapped_file& aFile, const std::string_view aCacheFilePath)
+	{
+		if (!read_cache_file_header(aFile.data(), aFile.size()).has_value()) {
+			throw gvk::runtime_error(fmt::format("The cache file '{}' is incomplete or has been written in an incompatible format.", aCacheFilePath));
+		}
+		// The mapping is page-aligned and all offsets are properly aligned, hence, the header and the table of contents can be used in place:
+		return reinterpret_cast<const cache_file_header*>(aFile.data());
+	}
+
+	serializer::deserialize::state::state(const std::string_view aCacheFilePath) :
+		mFile(aCacheFilePath),
+		mHeader(validated_cache_file_header(mFile, aCacheFilePath)),
+		mToc(reinterpret_cast<const cache_file_toc_entry*>(mFile.data() + mHeader->mTocOffset)),
+		// Structured data is read directly from the mapping, but never beyond the end of the archived data:
+		mStreambuf(mFile.data(), static_cast<size_t>(mHeader->mTocOffset), sizeof(cache_file_header)),
+		mIstream(&mStreambuf),
+		mArchive(mIstream)
+	{}
+
+	std::span<const std::byte> serializer::deserialize::read_blob(std::optional<size_t> aExpectedSize)
+	{
+		auto& s = *mState;
+		if (s.mNextBlob >= s.mHeader->mTocCount) {
+			throw gvk::runtime_error("Attempted to read more blobs than the cache file contains.");
+		}
+		const auto& entry = s.mToc[s.mNextBlob++];
+		if (entry.mOffset < s.mStreambuf.position() || entry.mOffset + entry.mSize > s.mHeader->mTocOffset) {
+			throw gvk::runtime_error("The cache file's table of contents is corrupt.");
+		}
+		if (aExpectedSize.has_value() && aExpectedSize.value() != entry.mSize) {
+			throw gvk::runtime_error(fmt::format("Expected a blob of {} bytes in the cache file, but found one of {} bytes.", aExpectedSize.value(), entry.mSize));
+		}
+		// Continue reading structured data after the blob:
+		s.mStreambuf.set_position(static_cast<size_t>(entry.mOffset + entry.mSize));
+		return std::span<const std::byte>(s.mFile.data() + entry.mOffset, static_cast<size_t>(entry.mSize));
+	}
+#pragma endregion
+}
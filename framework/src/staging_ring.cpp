@@ -0,0 +1,173 @@
+#include <gvk.hpp>
+
+namespace gvk
+{
+	staging_ring::allocation_data::~allocation_data()
+	{
+		if (!mOverflowBuffer.has_value()) {
+			mRing->release(mEntryId);
+		}
+	}
+
+	avk::buffer& staging_ring::allocation::buffer() const
+	{
+		assert(mData);
+		if (mData->mOverflowBuffer.has_value()) {
+			return mData->mOverflowBuffer.value();
+		}
+		assert(mData->mRing->mBuffer.has_value());
+		return mData->mRing->mBuffer.value();
+	}
+
+	void* staging_ring::allocation::mapped_data() const
+	{
+		assert(mData);
+		if (mData->mOverflowBuffer.has_value()) {
+			return nullptr;
+		}
+		assert(nullptr != mData->mRing->mMappedData);
+		return static_cast<void*>(mData->mRing->mMappedData + mData->mOffset);
+	}
+
+	staging_ring::allocation staging_ring::allocate(size_t aSize, size_t aAlignment)
+	{
+		aSize = std::max(aSize, size_t{ 1 });
+		auto alignUp = [aAlignment](size_t aOffset) { return (aOffset + aAlignment - 1) / aAlignment * aAlignment; };
+
+		std::unique_lock<std::mutex> lock(mMutex);
+
+		// (Re-)create the ring buffer lazily, and only when it is not in use:
+		if (mEntries.empty()) {
+			mHead = 0;
+			mTail = 0;
+			if (mBuffer.has_value() && mBuffer.value()->config().size != mCapacity) {
+				mMapping.reset();
+				mMappedData = nullptr;
+				mBuffer.reset();
+			}
+			if (!mBuffer.has_value() && aSize <= mCapacity) {
+				mBuffer = context().create_buffer(
+					AVK_STAGING_BUFFER_MEMORY_USAGE,
+					vk::BufferUsageFlagBits::eTransferSrc,
+					avk::generic_buffer_meta::create_from_size(mCapacity)
+				);
+				// The ring stays mapped for as long as it lives, so that writes do not have to map and unmap it:
+				try {
+					auto* mapping = new auto(mBuffer.value()->map_memory(avk::mapping_access::write));
+					mMapping = std::shared_ptr<void>(mapping);
+					mMappedData = static_cast<uint8_t*>(mapping->get());
+				}
+				catch (...) {
+					mBuffer.reset();
+					throw;
+				}
+				mStatistics.mCapacity = mCapacity;
+			}
+		}
+
+		// Find a free range; the ring is wrapped around if the tail is not behind the head:
+		std::optional<size_t> offset;
+		if (mBuffer.has_value()) {
+			const size_t ringSize = mBuffer.value()->config().size;
+			if (mEntries.empty() || mTail < mHead) {
+				if (alignUp(mHead) + aSize <= ringSize) {
+					offset = alignUp(mHead);
+				}
+				else if (aSize <= mTail) {
+					offset = 0;
+				}
+			}
+			else if (alignUp(mHead) + aSize <= mTail) {
+				offset = alignUp(mHead);
+			}
+		}
+
+		if (offset.has_value()) {
+			auto data = std::make_shared<allocation_data>();
+			data->mRing = this;
+			data->mSize = aSize;
+			data->mEntryId = mFirstEntryId + mEntries.size();
+			data->mOffset = offset.value();
+			mEntries.push_back(ring_entry{ offset.value(), offset.value() + aSize, false });
+			mHead = offset.value() + aSize;
+			mTail = mEntries.front().mBegin;
+
+			++mStatistics.mNumAllocations;
+			mStatistics.mBytesInUse += aSize;
+			mStatistics.mHighWaterMark = std::max(mStatistics.mHighWaterMark, mStatistics.mBytesInUse);
+			return allocation{ std::move(data) };
+		}
+
+		// Doesn't fit => serve it from a temporary staging buffer:
+		++mStatistics.mNumOverflows;
+		mStatistics.mOverflowBytes += aSize;
+		lock.unlock();
+
+		// Create the buffer first: an allocation_data without an overflow buffer would give back a ring entry when destroyed.
+		auto overflowBuffer = context().create_buffer(
+			AVK_STAGING_BUFFER_MEMORY_USAGE,
+			vk::BufferUsageFlagBits::eTransferSrc,
+			avk::generic_buffer_meta::create_from_size(aSize)
+		);
+		auto data = std::make_shared<allocation_data>();
+		data->mRing = this;
+		data->mSize = aSize;
+		data->mEntryId = 0;
+		data->mOffset = 0;
+		data->mOverflowBuffer = std::move(overflowBuffer);
+		return allocation{ std::move(data) };
+	}
+
+	void staging_ring::release(uint64_t aEntryId)
+	{
+		std::scoped_lock<std::mutex> lock(mMutex);
+		assert(aEntryId >= mFirstEntryId && aEntryId - mFirstEntryId < mEntries.size());
+		auto& entry = mEntries[static_cast<size_t>(aEntryId - mFirstEntryId)];
+		entry.mReleased = true;
+		mStatistics.mBytesInUse -= entry.mEnd - entry.mBegin;
+
+		// Memory can only be reclaimed in allocation order:
+		while (!mEntries.empty() && mEntries.front().mReleased) {
+			mEntries.pop_front();
+			++mFirstEntryId;
+		}
+		if (mEntries.empty()) {
+			mHead = 0;
+			mTail = 0;
+		}
+		else {
+			mTail = mEntries.front().mBegin;
+		}
+	}
+
+	void staging_ring::set_capacity(size_t aCapacity)
+	{
+		std::scoped_lock<std::mutex> lock(mMutex);
+		mCapacity = aCapacity;
+	}
+
+	staging_ring::statistics staging_ring::get_statistics() const
+	{
+		std::scoped_lock<std::mutex> lock(mMutex);
+		return mStatistics;
+	}
+
+	void staging_ring::reset_statistics()
+	{
+		std::scoped_lock<std::mutex> lock(mMutex);
+		mStatistics.mHighWaterMark = mStatistics.mBytesInUse;
+		mStatistics.mNumAllocations = 0;
+		mStatistics.mNumOverflows = 0;
+		mStatistics.mOverflowBytes = 0;
+	}
+
+	void staging_ring::cleanup()
+	{
+		// Allocations which are still alive (e.g. in command buffers which have not been destroyed yet)
+		// can not be used anymore, but they can still be given back to the ring.
+		std::scoped_lock<std::mutex> lock(mMutex);
+		mMapping.reset();
+		mMappedData = nullptr;
+		mBuffer.reset();
+	}
+}
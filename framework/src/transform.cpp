@@ -7,7 +7,8 @@ namespace gvk
 	void transform::update_matrix_from_transforms()
 	{
 		mMatrix = matrix_from_transforms(mTranslation, mRotation, mScale);
-		mInverseMatrix = glm::inverse(mMatrix);
+		mInverseMatrixDirty = true;
+		invalidate_global_matrices();
 	}
 	
 	void transform::update_transforms_from_matrix()
@@ -16,6 +17,20 @@ namespace gvk
 		mTranslation = translation;
 		mRotation = rotation;
 		mScale = scale;
+		mInverseMatrixDirty = true;
+		invalidate_global_matrices();
+	}
+
+	void transform::invalidate_global_matrices()
+	{
+		if (mGlobalMatrixDirty && mInverseGlobalMatrixDirty) {
+			return; // Then, they are also set for all the childs
+		}
+		mGlobalMatrixDirty = true;
+		mInverseGlobalMatrixDirty = true;
+		for (auto& child : mChilds) {
+			child->invalidate_global_matrices();
+		}
 	}
 
 	transform::transform(vec3 pTranslation, quat pRotation, vec3 pScale) noexcept
@@ -45,15 +60,9 @@ namespace gvk
 		, mTranslation{ std::move(other.mTranslation) }
 		, mRotation{ std::move(other.mRotation) }
 		, mScale{ std::move(other.mScale) }
-		, mParent{ std::move(other.mParent) }
-		, mChilds{ std::move(other.mChilds) }
 	{
-		for (auto& child : mChilds) {
-			// This will overwrite their previous parent-pointer:
-			attach_transform(shared_from_this(), child);
-		}
-		other.mParent = nullptr;
-		other.mChilds.clear();
+		// No shared_ptr owns this transform yet, i.e. it can neither be added to other's parent nor become
+		// the parent of other's childs => other keeps its place in the hierarchy.
 	}
 	
 	transform::transform(const transform& other) noexcept
@@ -62,51 +71,87 @@ namespace gvk
 		, mTranslation{ other.mTranslation }
 		, mRotation{ other.mRotation }
 		, mScale{ other.mScale }
-		, mParent{ other.mParent }
 	{
-		for (auto& child : other.mChilds) {
-			// Copy the childs. This can have undesired side effects, actually (e.g. if 
-			// childs' classes are derived from transform, what happens then? Don't know.)
-			auto clonedChild = std::make_shared<transform>(*child);
-			attach_transform(shared_from_this(), child);
-		}
+		// No shared_ptr owns this transform yet => same as for the move constructor, it does not join the hierarchy.
 	}
 	
 	transform& transform::operator=(transform&& other) noexcept
 	{
+		if (this == &other) {
+			return *this;
+		}
 		mMatrix = std::move(other.mMatrix);
 		mInverseMatrix = std::move(other.mInverseMatrix);
 		mTranslation = std::move(other.mTranslation);
 		mRotation = std::move(other.mRotation);
 		mScale = std::move(other.mScale);
-		mParent = std::move(other.mParent);
-		mChilds = std::move(other.mChilds);
-		for (auto& child : mChilds) {
-			// This will overwrite their previous parent-pointer:
-			attach_transform(shared_from_this(), child);
+		mInverseMatrixDirty = true;
+		// This transform keeps its own parent (only this way it remains in its parent's mChilds and gets invalidated
+		// by it), but its previous childs are replaced by other's:
+		detach_all_childs();
+		if (auto self = weak_from_this().lock()) {
+			// attach_transform removes from other.mChilds => don't iterate over other.mChilds itself:
+			auto childs = other.mChilds;
+			for (auto& child : childs) {
+				// This will overwrite their previous parent-pointer:
+				attach_transform(self, child);
+			}
+		}
+		else if (!other.mChilds.empty()) {
+			LOG_WARNING(fmt::format("The childs of transform[{}] are not moved to transform[{}] because it is not owned by a shared_ptr.", fmt::ptr(&other), fmt::ptr(this)));
 		}
-		other.mParent = nullptr;
-		other.mChilds.clear();
+
+		// Clear the flags first, s.t. invalidate_global_matrices does not return early and reaches all the childs:
+		mGlobalMatrixDirty = false;
+		mInverseGlobalMatrixDirty = false;
+		invalidate_global_matrices();
 		return *this;
 	}
 	
 	transform& transform::operator=(const transform& other) noexcept
 	{
+		if (this == &other) {
+			return *this;
+		}
 		mMatrix = other.mMatrix;
 		mInverseMatrix = other.mInverseMatrix;
 		mTranslation = other.mTranslation;
 		mRotation = other.mRotation;
 		mScale = other.mScale;
-		mParent = other.mParent;
-		for (auto& child : other.mChilds) {
-			// Copy the childs. This can have undesired side effects, actually (e.g. if 
-			// childs' classes are derived from transform, what happens then? Don't know.)
-			auto clonedChild = std::make_shared<transform>(*child);
-			attach_transform(shared_from_this(), child);
+		mInverseMatrixDirty = true;
+		// Like for the move assignment, this transform keeps its own parent, but its childs are replaced by copies of other's:
+		detach_all_childs();
+		if (auto self = weak_from_this().lock()) {
+			for (auto& child : other.mChilds) {
+				// Copy the childs. This can have undesired side effects, actually (e.g. if 
+				// childs' classes are derived from transform, what happens then? Don't know.)
+				// Assign instead of copy-constructing, s.t. the clone, being owned by a shared_ptr, also gets copies of the child's childs:
+				auto clonedChild = std::make_shared<transform>();
+				*clonedChild = *child;
+				attach_transform(self, clonedChild);
+			}
+		}
+		else if (!other.mChilds.empty()) {
+			LOG_WARNING(fmt::format("The childs of transform[{}] are not copied to transform[{}] because it is not owned by a shared_ptr.", fmt::ptr(&other), fmt::ptr(this)));
 		}
+
+		// Clear the flags first, s.t. invalidate_global_matrices does not return early and reaches all the childs:
+		mGlobalMatrixDirty = false;
+		mInverseGlobalMatrixDirty = false;
+		invalidate_global_matrices();
 		return *this;
 	}
 
+	void transform::detach_all_childs()
+	{
+		// Same as detach_transform for each child, but without the lookup in mChilds:
+		for (auto& child : mChilds) {
+			child->mParent = nullptr;
+			child->invalidate_global_matrices();
+		}
+		mChilds.clear();
+	}
+
 	transform::~transform()
 	{
 		mParent = nullptr;
@@ -138,22 +183,35 @@ namespace gvk
 
 	glm::mat4 transform::inverse_local_transformation_matrix() const
 	{
+		if (mInverseMatrixDirty) {
+			// Transforms consist of translation, rotation, and scale only => they are affine:
+			mInverseMatrix = inverse_affine(mMatrix);
+			mInverseMatrixDirty = false;
+		}
 		return mInverseMatrix;
 	}
 	
 	glm::mat4 transform::global_transformation_matrix() const
 	{
-		if (mParent) {
-			return mParent->global_transformation_matrix() * mMatrix;
-		}
-		else {
-			return mMatrix;
+		if (mGlobalMatrixDirty) {
+			if (mParent) {
+				mGlobalMatrix = mParent->global_transformation_matrix() * mMatrix;
+			}
+			else {
+				mGlobalMatrix = mMatrix;
+			}
+			mGlobalMatrixDirty = false;
 		}
+		return mGlobalMatrix;
 	}
 
 	glm::mat4 transform::inverse_global_transformation_matrix() const
 	{
-		return glm::inverse(global_transformation_matrix());
+		if (mInverseGlobalMatrixDirty) {
+			mInverseGlobalMatrix = inverse_affine(global_transformation_matrix());
+			mInverseGlobalMatrixDirty = false;
+		}
+		return mInverseGlobalMatrix;
 	}
 
 	void transform::look_at(const glm::vec3& aPosition)
@@ -206,6 +264,7 @@ namespace gvk
 		}
 		pChild->mParent = pParent;
 		pParent->mChilds.push_back(pChild);
+		pChild->invalidate_global_matrices();
 	}
 
 	void detach_transform(transform::ptr pParent, transform::ptr pChild)
@@ -217,6 +276,7 @@ namespace gvk
 			return;
 		}
 		pChild->mParent = nullptr;
+		pChild->invalidate_global_matrices();
 		pParent->mChilds.erase(std::remove(
 				std::begin(pParent->mChilds), std::end(pParent->mChilds),
 				pChild
@@ -0,0 +1,70 @@
+#include <gvk.hpp>
+
+namespace gvk
+{
+	upload_batch::upload_batch(avk::sync aSyncHandler)
+		: mSync{ std::move(aSyncHandler) }
+	{ }
+
+	upload_batch::~upload_batch()
+	{
+		if (!mSubmitted && mNumOperations > 0) {
+			LOG_WARNING(fmt::format("An upload_batch with {} operations is being destroyed without having been submitted. Submitting it now.", mNumOperations));
+			try {
+				submit();
+			}
+			catch (std::exception& e) {
+				LOG_ERROR(fmt::format("Submitting the upload_batch failed: {}", e.what()));
+			}
+		}
+	}
+
+	avk::sync upload_batch::sync()
+	{
+		if (mSubmitted) {
+			throw gvk::logic_error("Can't add further operations to an upload_batch which has been submitted already.");
+		}
+		// Recycle staging memory before the ring runs full and further uploads would require temporary overflow buffers:
+		const auto ringStats = context().upload_staging_ring().get_statistics();
+		if (mChunk.has_value() && ringStats.mBytesInUse > ringStats.mCapacity / 2) {
+			submit_chunk();
+			++mNumIntermediateSubmissions;
+		}
+
+		if (!mChunk.has_value()) {
+			mChunk.emplace(avk::sync::wait_idle());
+		}
+		++mNumOperations;
+		// Invoke the chunk's before-handler exactly once (if there is something to sync), and its after-handler in submit_chunk()
+		return avk::sync::auxiliary_with_barriers(mChunk.value(), avk::sync::steal_before_handler_on_demand, {});
+	}
+
+	void upload_batch::submit_chunk()
+	{
+		assert(mChunk.has_value());
+		mChunk->get_or_create_command_buffer();
+		mChunk->establish_barrier_after_the_operation(avk::pipeline_stage::transfer, avk::write_memory_access{ avk::memory_access::transfer_write_access });
+		mChunk->submit_and_sync();
+		mChunk.reset();
+	}
+
+	std::optional<avk::command_buffer> upload_batch::submit()
+	{
+		if (mSubmitted) {
+			throw gvk::logic_error("The upload_batch has been submitted already.");
+		}
+		mSubmitted = true;
+		if (0 == mNumOperations) {
+			return {};
+		}
+
+		if (mChunk.has_value()) {
+			submit_chunk();
+		}
+
+		// All uploads have completed; the external sync handler establishes the final barrier and signals their completion:
+		mSync.get_or_create_command_buffer();
+		mSync.establish_barrier_after_the_operation(avk::pipeline_stage::transfer, avk::write_memory_access{ avk::memory_access::transfer_write_access });
+		return mSync.submit_and_sync();
+	}
+}
@@ -0,0 +1,8 @@
+// cg_stdafx.cpp : source file that includes just the standard includes
+// cg_stdafx.pch will be the pre-compiled header
+// cg_stdafx.obj will contain the pre-compiled type information
+
+#include "cg_stdafx.hpp"
+
+// TODO: reference any additional headers you need in cg_stdafx.hpp
+// and not in this file